@@ -4,26 +4,24 @@
  */
 
 #include "BytePool.hpp"
+#include "LogLevel.hpp"
 
 using namespace Stm32ThreadX;
 
 UINT BytePool::create(VOID *pool_start, ULONG pool_size) {
-    log(Stm32ItmLogger::LoggerInterface::Severity::INFORMATIONAL)
-            ->printf("Stm32ThreadX::BytePool[%s]::create()\r\n", getName());
+    LIBSMART_LOG(INFORMATIONAL, "Stm32ThreadX::BytePool[%s]::create()\r\n", getName());
 
     // Create the IP instance
     const auto ret = tx_byte_pool_create(bytePool, const_cast<CHAR *>(getName()), pool_start, pool_size);
     if (ret != TX_SUCCESS) {
-        log(Stm32ItmLogger::LoggerInterface::Severity::ERROR)
-                ->printf("Byte pool creation failed. tx_byte_pool_create() = 0x%02x\r\n", ret);
+        LIBSMART_LOG(ERROR, "Byte pool creation failed. tx_byte_pool_create() = 0x%02x\r\n", ret);
     }
 
     return ret;
 }
 
 void BytePool::setBytePoolStruct(TX_BYTE_POOL *txBytePool) {
-    log(Stm32ItmLogger::LoggerInterface::Severity::INFORMATIONAL)
-            ->printf("Stm32ThreadX::BytePool[%s]::setBytePoolStruct()\r\n", txBytePool->tx_byte_pool_name);
+    LIBSMART_LOG(INFORMATIONAL, "Stm32ThreadX::BytePool[%s]::setBytePoolStruct()\r\n", txBytePool->tx_byte_pool_name);
 
     bytePool = txBytePool;
     setName(bytePool->tx_byte_pool_name);
@@ -31,8 +29,7 @@ void BytePool::setBytePoolStruct(TX_BYTE_POOL *txBytePool) {
 
 
 UCHAR *BytePool::allocate(const ULONG memory_size) {
-    log(Stm32ItmLogger::LoggerInterface::Severity::INFORMATIONAL)
-            ->printf("Stm32ThreadX::BytePool[%s]::allocate(%d)\r\n", getName(), memory_size);
+    LIBSMART_LOG(INFORMATIONAL, "Stm32ThreadX::BytePool[%s]::allocate(%d)\r\n", getName(), memory_size);
 
     UINT ret = TX_SUCCESS;
     UCHAR *memPtr = nullptr;
@@ -42,21 +39,18 @@ UCHAR *BytePool::allocate(const ULONG memory_size) {
                            memory_size,
                            TX_NO_WAIT);
     if (ret != TX_SUCCESS) {
-        log(Stm32ItmLogger::LoggerInterface::Severity::ERROR)
-                ->printf("Byte allocation failed. tx_byte_allocate() = 0x%02x\r\n", ret);
+        LIBSMART_LOG(ERROR, "Byte allocation failed. tx_byte_allocate() = 0x%02x\r\n", ret);
         return nullptr;
     }
     return memPtr;
 }
 
 UINT BytePool::release(void *memory_ptr) {
-    log(Stm32ItmLogger::LoggerInterface::Severity::INFORMATIONAL)
-            ->printf("Stm32ThreadX::BytePool[%s]::release()\r\n", getName());
+    LIBSMART_LOG(INFORMATIONAL, "Stm32ThreadX::BytePool[%s]::release()\r\n", getName());
 
     const auto ret = tx_byte_release(memory_ptr);
     if (ret != TX_SUCCESS) {
-        log(Stm32ItmLogger::LoggerInterface::Severity::ERROR)
-                ->printf("Byte release failed. tx_byte_release() = 0x%02x\r\n", ret);
+        LIBSMART_LOG(ERROR, "Byte release failed. tx_byte_release() = 0x%02x\r\n", ret);
     }
     return ret;
 }
@@ -0,0 +1,224 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+
+#include <coroutine>
+#include "Executor.hpp"
+#include "Task.hpp"
+#include "TickTimer.hpp"
+#include "Queue/BaseQueue.hpp"
+#include "Semaphore/BaseSemaphore.hpp"
+#include "EventFlags/BaseEventFlags.hpp"
+#include "EventFlags/EventFlags.hpp"
+
+namespace Stm32ThreadX {
+    namespace coro {
+        namespace detail {
+            /**
+             * Common part of the awaitables that park the task until an operation succeeds or times out.
+             *
+             * `Derived` provides `tryOnce()`, a non-blocking attempt that returns false while the object is not
+             * ready and otherwise stores the result in `status`, and `arm()`, which installs the notify hook.
+             */
+            template<typename Derived>
+            class ParkingAwaiter : protected Waiter {
+            public:
+                bool await_ready() {
+                    auto &self = static_cast<Derived &>(*this);
+                    if (self.tryOnce()) return true;
+
+                    // Try again after installing the hook, a notification in between would be lost otherwise
+                    self.arm();
+                    return self.tryOnce();
+                }
+
+                template<typename Promise>
+                void await_suspend(std::coroutine_handle<Promise> caller) {
+                    handle = caller;
+                    poll = [](Waiter &waiter) { return static_cast<Derived &>(waiter).tryOnce(); };
+                    if (timed) deadline = tx_time_get() + timeout;
+                    caller.promise().executor->park(*this);
+                }
+
+                UINT await_resume() const noexcept { return status; }
+
+            protected:
+                ParkingAwaiter(const tick_timer::duration &rel_time, UINT timeoutStatusCode)
+                    : timeout(toTicks(rel_time)) {
+                    timed = rel_time != infinity;
+                    timeoutStatus = timeoutStatusCode;
+                }
+
+            private:
+                ULONG timeout;
+            };
+
+            class ReceiveAwaiter : public ParkingAwaiter<ReceiveAwaiter> {
+            public:
+                ReceiveAwaiter(BaseQueue &queue, VOID *destination_ptr, const tick_timer::duration &rel_time)
+                    : ParkingAwaiter(rel_time, TX_QUEUE_EMPTY), queue(queue), destination(destination_ptr) {
+                    object = &queue;
+                }
+
+            private:
+                friend class ParkingAwaiter<ReceiveAwaiter>;
+
+                bool tryOnce() {
+                    status = queue.receive(destination, TX_NO_WAIT);
+                    return status != TX_QUEUE_EMPTY;
+                }
+
+                void arm() { queue.send_notify(&Executor::queueNotify); }
+
+                BaseQueue &queue;
+                VOID *destination;
+            };
+
+            class GetAwaiter : public ParkingAwaiter<GetAwaiter> {
+            public:
+                GetAwaiter(BaseSemaphore &semaphore, const tick_timer::duration &rel_time)
+                    : ParkingAwaiter(rel_time, TX_NO_INSTANCE), semaphore(semaphore) {
+                    object = &semaphore;
+                }
+
+            private:
+                friend class ParkingAwaiter<GetAwaiter>;
+
+                bool tryOnce() {
+                    status = semaphore.get(TX_NO_WAIT);
+                    return status != TX_NO_INSTANCE;
+                }
+
+                void arm() { semaphore.put_notify(&Executor::semaphoreNotify); }
+
+                BaseSemaphore &semaphore;
+            };
+
+            class FlagsAwaiter : public ParkingAwaiter<FlagsAwaiter> {
+            public:
+                FlagsAwaiter(BaseEventFlags &eventFlags, ULONG requestedFlags, EventFlags::getOption_t getOption,
+                             ULONG *actualFlags, const tick_timer::duration &rel_time)
+                    : ParkingAwaiter(rel_time, TX_NO_EVENTS), eventFlags(eventFlags), requestedFlags(requestedFlags),
+                      getOption(getOption), actualFlags(actualFlags) {
+                    object = &eventFlags;
+                }
+
+            private:
+                friend class ParkingAwaiter<FlagsAwaiter>;
+
+                bool tryOnce() {
+                    ULONG observed{};
+                    status = eventFlags.get(requestedFlags, static_cast<UINT>(getOption), &observed, TX_NO_WAIT);
+                    if (status == TX_NO_EVENTS) return false;
+                    if (actualFlags != nullptr) *actualFlags = observed;
+                    return true;
+                }
+
+                void arm() { eventFlags.set_notify(&Executor::eventFlagsNotify); }
+
+                BaseEventFlags &eventFlags;
+                ULONG requestedFlags;
+                EventFlags::getOption_t getOption;
+                ULONG *actualFlags;
+            };
+
+            class SleepAwaiter : public ParkingAwaiter<SleepAwaiter> {
+            public:
+                explicit SleepAwaiter(const tick_timer::duration &rel_time)
+                    : ParkingAwaiter(rel_time, TX_SUCCESS), expired(rel_time.count() == 0) { ; }
+
+                void await_resume() const noexcept { ; }
+
+            private:
+                friend class ParkingAwaiter<SleepAwaiter>;
+
+                bool tryOnce() const { return expired; }
+
+                void arm() { ; }
+
+                bool expired;
+            };
+
+            class YieldAwaiter : protected Waiter {
+            public:
+                bool await_ready() const noexcept { return false; }
+
+                template<typename Promise>
+                void await_suspend(std::coroutine_handle<Promise> caller) {
+                    handle = caller;
+                    caller.promise().executor->schedule(*this);
+                }
+
+                void await_resume() const noexcept { ; }
+            };
+        }
+
+        /**
+         * @brief Receives a message, suspending the task while the queue is empty.
+         *
+         * `co_await receive(queue, &message)` yields TX_SUCCESS, TX_QUEUE_EMPTY on timeout, or the status code of
+         * `tx_queue_receive()`.
+         *
+         * @param queue The queue to receive from. Its send notify hook is taken over.
+         * @param destination_ptr Receives the message.
+         * @param rel_time The maximum time to wait, `infinity` by default.
+         */
+        inline detail::ReceiveAwaiter receive(BaseQueue &queue, VOID *destination_ptr,
+                                              const tick_timer::duration &rel_time = infinity) {
+            return {queue, destination_ptr, rel_time};
+        }
+
+        /**
+         * @brief Takes a semaphore instance, suspending the task while there is none.
+         *
+         * `co_await get(semaphore)` yields TX_SUCCESS, TX_NO_INSTANCE on timeout, or the status code of
+         * `tx_semaphore_get()`.
+         *
+         * @param semaphore The semaphore. Its put notify hook is taken over.
+         * @param rel_time The maximum time to wait, `infinity` by default.
+         */
+        inline detail::GetAwaiter get(BaseSemaphore &semaphore, const tick_timer::duration &rel_time = infinity) {
+            return {semaphore, rel_time};
+        }
+
+        /**
+         * @brief Waits for event flags, suspending the task until the request is satisfied.
+         *
+         * `co_await await(flags, mask)` yields TX_SUCCESS, TX_NO_EVENTS on timeout, or the status code of
+         * `tx_event_flags_get()`.
+         *
+         * @param eventFlags The event flags group. Its set notify hook is taken over.
+         * @param requestedFlags The flags to wait for.
+         * @param getOption AND, OR, AND_CLEAR or OR_CLEAR.
+         * @param actualFlags Receives the flags that satisfied the request, if not nullptr.
+         * @param rel_time The maximum time to wait, `infinity` by default.
+         */
+        inline detail::FlagsAwaiter await(BaseEventFlags &eventFlags, ULONG requestedFlags,
+                                          EventFlags::getOption_t getOption = EventFlags::getOption_t::AND,
+                                          ULONG *actualFlags = nullptr,
+                                          const tick_timer::duration &rel_time = infinity) {
+            return {eventFlags, requestedFlags, getOption, actualFlags, rel_time};
+        }
+
+        /**
+         * @brief Suspends the task for a time, without blocking the executor thread.
+         */
+        inline detail::SleepAwaiter sleepFor(const tick_timer::duration &rel_time) {
+            return detail::SleepAwaiter(rel_time);
+        }
+
+        /**
+         * @brief Lets the other ready tasks run first.
+         */
+        inline detail::YieldAwaiter yield() {
+            return {};
+        }
+    }
+}
+
+#endif
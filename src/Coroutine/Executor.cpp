@@ -0,0 +1,190 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "Executor.hpp"
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+
+#include "LogLevel.hpp"
+#include "Queue/BaseQueue.hpp"
+#include "Semaphore/BaseSemaphore.hpp"
+
+using namespace Stm32ThreadX;
+using namespace Stm32ThreadX::coro;
+
+namespace {
+    BytePool *framePool = nullptr;
+}
+
+void coro::setFramePool(BytePool &pool) {
+    framePool = &pool;
+}
+
+void *detail::PromiseBase::operator new(std::size_t size) noexcept {
+    if (framePool == nullptr) return nullptr;
+    return framePool->allocate(size);
+}
+
+void detail::PromiseBase::operator delete(void *ptr) noexcept {
+    if (ptr != nullptr) framePool->release(ptr);
+}
+
+void detail::PromiseBase::taskFinished(Executor *executor) {
+    const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+    executor->tasks = executor->tasks - 1;
+    tx_interrupt_control(posture);
+}
+
+Executor *Executor::executors = nullptr;
+
+UINT Executor::create() {
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::coro::Executor[%s]::create()\r\n", getName());
+
+    const auto ret = wake.create();
+    if (ret != TX_SUCCESS) return ret;
+
+    // The notify hooks may run in ISR context and walk the list
+    const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+    nextExecutor = executors;
+    executors = this;
+    tx_interrupt_control(posture);
+    return ret;
+}
+
+UINT Executor::del() {
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::coro::Executor[%s]::del()\r\n", getName());
+
+    const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+    Executor **slot = &executors;
+    while (*slot != nullptr && *slot != this) slot = &(*slot)->nextExecutor;
+    if (*slot != nullptr) *slot = nextExecutor;
+    nextExecutor = nullptr;
+    tx_interrupt_control(posture);
+
+    return wake.deleteFlags();
+}
+
+void Executor::runOnce(ULONG wait_option) {
+    // Clear before polling, so a notification during the pass is not lost
+    wake.clear(READY | POLL);
+
+    ULONG timeout;
+    do {
+        resumeReady();
+        timeout = pollParked();
+    } while (readyHead != nullptr);
+
+    if (wait_option < timeout) timeout = wait_option;
+    ULONG actualFlags{};
+    wake.get(READY | POLL, EventFlags::getOption_t::OR, actualFlags, EventFlags::waitOption_t{timeout});
+}
+
+void Executor::run() {
+    for (;;) {
+        runOnce(TX_WAIT_FOREVER);
+    }
+}
+
+void Executor::schedule(detail::Waiter &waiter) {
+    waiter.next = nullptr;
+    const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+    if (readyTail != nullptr) {
+        readyTail->next = &waiter;
+    } else {
+        readyHead = &waiter;
+    }
+    readyTail = &waiter;
+    tx_interrupt_control(posture);
+}
+
+void Executor::park(detail::Waiter &waiter) {
+    // A notification since the last try found no parked waiter to mark, so poll once more
+    waiter.notified = true;
+    const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+    waiter.next = parked;
+    parked = &waiter;
+    tx_interrupt_control(posture);
+}
+
+void Executor::resumeReady() {
+    // Take the whole list, so a task that yields runs again only after the suspended tasks were polled
+    const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+    detail::Waiter *waiter = readyHead;
+    readyHead = nullptr;
+    readyTail = nullptr;
+    tx_interrupt_control(posture);
+
+    while (waiter != nullptr) {
+        auto *next = waiter->next;
+        waiter->handle.resume();
+        waiter = next;
+    }
+}
+
+ULONG Executor::pollParked() {
+    const auto now = tx_time_get();
+    ULONG nearest = TX_WAIT_FOREVER;
+
+    detail::Waiter **slot = &parked;
+    while (*slot != nullptr) {
+        auto *waiter = *slot;
+        bool done = false;
+        if (waiter->notified) {
+            // Clear first, so a notification during the poll marks the waiter again
+            waiter->notified = false;
+            done = waiter->poll != nullptr && waiter->poll(*waiter);
+        }
+        if (!done && waiter->timed) {
+            const auto left = static_cast<LONG>(waiter->deadline - now);
+            if (left <= 0) {
+                waiter->status = waiter->timeoutStatus;
+                done = true;
+            } else if (static_cast<ULONG>(left) < nearest) {
+                nearest = static_cast<ULONG>(left);
+            }
+        }
+
+        if (done) {
+            // The notify hooks walk the list
+            const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+            *slot = waiter->next;
+            tx_interrupt_control(posture);
+            schedule(*waiter);
+        } else {
+            slot = &waiter->next;
+        }
+    }
+    return nearest;
+}
+
+void Executor::notifyWaiters(const void *object) {
+    // May run in ISR context, so only mark the waiters. The executor thread completes the waits.
+    for (auto *executor = executors; executor != nullptr; executor = executor->nextExecutor) {
+        bool found = false;
+        const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+        for (auto *waiter = executor->parked; waiter != nullptr; waiter = waiter->next) {
+            if (waiter->object != object) continue;
+            waiter->notified = true;
+            found = true;
+        }
+        tx_interrupt_control(posture);
+
+        if (found) executor->wake.set(POLL);
+    }
+}
+
+void Executor::queueNotify(TX_QUEUE *queue_ptr) {
+    notifyWaiters(BaseQueue::fromNative(queue_ptr));
+}
+
+void Executor::semaphoreNotify(TX_SEMAPHORE *semaphore_ptr) {
+    notifyWaiters(BaseSemaphore::fromNative(semaphore_ptr));
+}
+
+void Executor::eventFlagsNotify(TX_EVENT_FLAGS_GROUP *group_ptr) {
+    notifyWaiters(BaseEventFlags::fromNative(group_ptr));
+}
+
+#endif
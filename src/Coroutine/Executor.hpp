@@ -0,0 +1,161 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+
+#include <libsmart_config.hpp>
+#include "Loggable.hpp"
+#include "Nameable.hpp"
+#include "tx_api.h"
+#include "Task.hpp"
+#include "EventFlags/EventFlags.hpp"
+
+namespace Stm32ThreadX {
+    namespace coro {
+        namespace detail {
+            template<typename Derived>
+            class ParkingAwaiter;
+
+            class YieldAwaiter;
+        }
+
+        /**
+         * @class Executor
+         * @brief Runs many coroutine tasks on the single thread that calls `run()`.
+         *
+         * Tasks suspend in the awaitables of `Awaitables.hpp` instead of blocking the thread. A suspended task
+         * costs its frame from the byte pool and no stack. Awaitables install the notify hook of their queue,
+         * semaphore or event flags group (`send_notify()`, `put_notify()`, `set_notify()`). The hook marks the
+         * tasks waiting for that object and wakes only the executors that have one. The executor then completes
+         * the marked waits with non-blocking calls, resumes the ready tasks and sleeps until the next notification
+         * or the nearest timeout. Finding the marked tasks walks the suspended list with interrupts disabled, so
+         * prefer one executor per group of related sessions over one for everything.
+         *
+         * Taking over the notify hook conflicts with a `QueueSet` on the same object.
+         */
+        class Executor : public Stm32ItmLogger::Loggable, public Stm32Common::Nameable {
+        public:
+            Executor() : Executor(&Stm32ItmLogger::emptyLogger) { ; }
+
+            explicit Executor(const char *name)
+                : Executor(name, &Stm32ItmLogger::emptyLogger) { ; }
+
+            explicit Executor(Stm32ItmLogger::LoggerInterface *logger)
+                : Executor("Stm32ThreadX::coro::Executor", logger) { ; }
+
+            Executor(const char *name, Stm32ItmLogger::LoggerInterface *logger)
+                : Loggable(logger), Nameable(name), wake(name, logger) { ; }
+
+            /**
+             * @brief Creates the event flags group the executor thread sleeps on.
+             *
+             * @return The status code of `tx_event_flags_create()`.
+             */
+            UINT create();
+
+            /**
+             * @brief Deletes the event flags group. Suspended tasks are not resumed anymore.
+             *
+             * @return The status code of `tx_event_flags_delete()`.
+             */
+            UINT del();
+
+            /**
+             * @brief Hands a task to the executor, which owns and runs it from now on.
+             *
+             * Thread context callable, from any thread.
+             *
+             * @return TX_SUCCESS, or TX_NO_MEMORY if the task frame could not be allocated.
+             */
+            template<typename T>
+            UINT spawn(Task<T> &&task) {
+                if (!task.valid()) return TX_NO_MEMORY;
+
+                auto handle = task.release();
+                auto &promise = handle.promise();
+                promise.executor = this;
+                promise.detached = true;
+                promise.start.handle = handle;
+
+                const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+                tasks = tasks + 1;
+                tx_interrupt_control(posture);
+
+                schedule(promise.start);
+                return wake.set(READY);
+            }
+
+            /**
+             * @brief Runs one scheduling pass and then waits for work.
+             *
+             * @param wait_option The maximum number of ticks to wait for a notification, spawn or timeout.
+             */
+            void runOnce(ULONG wait_option);
+
+            /**
+             * @brief Runs tasks forever. Use as the body of the executor thread.
+             */
+            [[noreturn]] void run();
+
+            /**
+             * @brief Returns the number of spawned tasks that have not finished.
+             */
+            [[nodiscard]] ULONG getTaskCount() const { return tasks; }
+
+            /**
+             * @brief Notify hooks installed by the awaitables. They wake the executors waiting for the object.
+             */
+            static void queueNotify(TX_QUEUE *queue_ptr);
+
+            static void semaphoreNotify(TX_SEMAPHORE *semaphore_ptr);
+
+            static void eventFlagsNotify(TX_EVENT_FLAGS_GROUP *group_ptr);
+
+        private:
+            friend class detail::PromiseBase;
+
+            template<typename Derived>
+            friend class detail::ParkingAwaiter;
+
+            friend class detail::YieldAwaiter;
+
+            static constexpr ULONG READY = 0x01;
+            static constexpr ULONG POLL = 0x02;
+
+            /** Appends to the ready list. */
+            void schedule(detail::Waiter &waiter);
+
+            /** Adds to the suspended list, marked for one poll. Executor thread only. */
+            void park(detail::Waiter &waiter);
+
+            /** Resumes the tasks that are in the ready list now. */
+            void resumeReady();
+
+            /**
+             * Polls the marked waiters and moves completed and expired ones to the ready list.
+             *
+             * @return The ticks until the nearest deadline, TX_WAIT_FOREVER if there is none.
+             */
+            ULONG pollParked();
+
+            /** Marks the waiters of `object` in all executors and wakes the executors that have one. */
+            static void notifyWaiters(const void *object);
+
+            /** All created executors, for the notify hooks. */
+            static Executor *executors;
+
+            EventFlags wake;
+            detail::Waiter *readyHead{};
+            detail::Waiter *readyTail{};
+            detail::Waiter *parked{};
+            Executor *nextExecutor{};
+            volatile ULONG tasks{};
+        };
+    }
+}
+
+#endif
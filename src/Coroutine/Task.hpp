@@ -0,0 +1,205 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include "BytePool.hpp"
+#include "tx_api.h"
+
+namespace Stm32ThreadX {
+    namespace coro {
+        class Executor;
+
+        /**
+         * @brief Sets the byte pool all coroutine frames are allocated from.
+         *
+         * Must be called before the first coroutine is created. Without a pool every coroutine call returns an
+         * invalid `Task`.
+         */
+        void setFramePool(BytePool &pool);
+
+        namespace detail {
+            /**
+             * A suspended coroutine in one of the executor's lists. Awaitables derive from it, so the node lives
+             * in the coroutine frame and parking never allocates.
+             */
+            struct Waiter {
+                Waiter *next{};
+                std::coroutine_handle<> handle;
+                /** Completes the operation without blocking. Returns false while it is not ready. */
+                bool (*poll)(Waiter &self){};
+                /** The queue, semaphore or event flags group waited for, nullptr if none. */
+                const void *object{};
+                /** Set by the notify hook of `object`, the executor polls only marked waiters. */
+                volatile bool notified{};
+                /** Tick count at which the wait times out, if `timed`. */
+                ULONG deadline{};
+                bool timed{};
+                /** Result passed to the coroutine, `timeoutStatus` if the deadline passed first. */
+                UINT status{TX_SUCCESS};
+                UINT timeoutStatus{TX_SUCCESS};
+            };
+
+            class PromiseBase {
+            public:
+                static void *operator new(std::size_t size) noexcept;
+
+                static void operator delete(void *ptr) noexcept;
+
+                std::suspend_always initial_suspend() noexcept { return {}; }
+
+                struct FinalAwaiter {
+                    bool await_ready() noexcept { return false; }
+
+                    template<typename Promise>
+                    std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> self) noexcept {
+                        auto &promise = self.promise();
+                        if (promise.continuation) return promise.continuation;
+                        if (promise.detached) {
+                            // Nobody owns a spawned task, so it frees its frame itself
+                            auto *executor = promise.executor;
+                            self.destroy();
+                            taskFinished(executor);
+                        }
+                        return std::noop_coroutine();
+                    }
+
+                    void await_resume() noexcept { ; }
+                };
+
+                FinalAwaiter final_suspend() noexcept { return {}; }
+
+                void unhandled_exception() noexcept { std::terminate(); }
+
+                Executor *executor{};
+                std::coroutine_handle<> continuation;
+                bool detached{};
+                /** Links the task into the ready list when it is spawned. */
+                Waiter start;
+
+            private:
+                static void taskFinished(Executor *executor);
+            };
+
+            template<typename T>
+            class PromiseResult {
+            public:
+                void return_value(T value) { result.emplace(std::move(value)); }
+
+                T takeResult() { return std::move(*result); }
+
+            private:
+                std::optional<T> result;
+            };
+
+            template<>
+            class PromiseResult<void> {
+            public:
+                void return_void() noexcept { ; }
+
+                void takeResult() { ; }
+            };
+        }
+
+        /**
+         * @class Task
+         * @brief A lazily started coroutine that returns a `T`.
+         *
+         * A task runs when it is awaited by another task with `co_await`, or when it is handed to
+         * `Executor::spawn()`. The frame comes from the pool set with `setFramePool()`. If it cannot be
+         * allocated, the task is not `valid()`; spawning it fails and awaiting it returns `T{}` at once.
+         *
+         * @tparam T The result type, `void` for none.
+         */
+        template<typename T = void>
+        class Task {
+        public:
+            struct promise_type : detail::PromiseBase, detail::PromiseResult<T> {
+                Task get_return_object() noexcept {
+                    return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+                }
+
+                static Task get_return_object_on_allocation_failure() noexcept { return Task(); }
+            };
+
+            using handle_t = std::coroutine_handle<promise_type>;
+
+            Task() = default;
+
+            Task(Task &&other) noexcept
+                : handle(std::exchange(other.handle, nullptr)) { ; }
+
+            Task &operator=(Task &&other) noexcept {
+                if (this != &other) {
+                    if (handle) handle.destroy();
+                    handle = std::exchange(other.handle, nullptr);
+                }
+                return *this;
+            }
+
+            Task(const Task &) = delete;
+
+            Task &operator=(const Task &) = delete;
+
+            ~Task() {
+                if (handle) handle.destroy();
+            }
+
+            /**
+             * @brief Returns false if the frame could not be allocated.
+             */
+            [[nodiscard]] bool valid() const { return static_cast<bool>(handle); }
+
+            struct awaiter {
+                handle_t task;
+
+                bool await_ready() noexcept { return !task || task.done(); }
+
+                template<typename Promise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> caller) noexcept {
+                    task.promise().continuation = caller;
+                    task.promise().executor = caller.promise().executor;
+                    return task;
+                }
+
+                T await_resume() {
+                    if constexpr (std::is_void_v<T>) {
+                        if (task) task.promise().takeResult();
+                    } else {
+                        if (!task) return T{};
+                        return task.promise().takeResult();
+                    }
+                }
+            };
+
+            /**
+             * @brief Runs the task until it completes, then resumes the awaiting task with its result.
+             */
+            awaiter operator co_await() && noexcept {
+                return awaiter{handle};
+            }
+
+        private:
+            friend class Executor;
+
+            explicit Task(handle_t handle)
+                : handle(handle) { ; }
+
+            handle_t release() { return std::exchange(handle, nullptr); }
+
+            handle_t handle;
+        };
+    }
+}
+
+#endif
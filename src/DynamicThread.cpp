@@ -0,0 +1,118 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "DynamicThread.hpp"
+
+#include "globals.hpp"
+#include "main.hpp"
+
+using namespace Stm32ThreadX;
+
+DynamicThread *DynamicThread::head = nullptr;
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+volatile ULONG DynamicThread::exited = 0;
+#endif
+
+DynamicThread::~DynamicThread() {
+    del();
+}
+
+UINT DynamicThread::create() {
+    del();
+
+    stack = pool.allocate(stackSize);
+    if (stack == nullptr) return TX_NO_MEMORY;
+
+    setStack(stack, stackSize);
+    const auto ret = createThreadSuspended();
+    if (ret != TX_SUCCESS) {
+        release();
+        return ret;
+    }
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+    // Before the thread can run, so a thread that completes at once is still counted
+    // https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_thread_entry_exit_notify
+    const volatile auto result = tx_thread_entry_exit_notify(this, &DynamicThread::exitNotify);
+    assert_param(result == TX_SUCCESS);
+#endif
+
+    link();
+    if (isAutoStart()) resume();
+    return TX_SUCCESS;
+}
+
+void DynamicThread::del() {
+    unlink();
+    deleteThread();
+    release();
+}
+
+UINT DynamicThread::reclaim() {
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+    auto posture = tx_interrupt_control(TX_INT_DISABLE);
+    const bool any = exited != 0;
+    exited = 0;
+    tx_interrupt_control(posture);
+    if (!any) return 0;
+#endif
+
+    UINT count = 0;
+    for (;;) {
+        // Unlink one finished thread at a time, so the list is never walked outside the lock
+        const auto lock = tx_interrupt_control(TX_INT_DISABLE);
+        DynamicThread **slot = &head;
+        while (*slot != nullptr && !(*slot)->isFinished()) slot = &(*slot)->next;
+        DynamicThread *finished = *slot;
+        if (finished != nullptr) {
+            *slot = finished->next;
+            finished->next = nullptr;
+        }
+        tx_interrupt_control(lock);
+
+        if (finished == nullptr) return count;
+        finished->deleteThread();
+        finished->release();
+        ++count;
+    }
+}
+
+void DynamicThread::release() {
+    if (stack == nullptr) return;
+    pool.release(stack);
+    stack = nullptr;
+}
+
+bool DynamicThread::isFinished() const {
+    return tx_thread_id != 0 && (tx_thread_state == TX_COMPLETED || tx_thread_state == TX_TERMINATED);
+}
+
+void DynamicThread::link() {
+    const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+    next = head;
+    head = this;
+    tx_interrupt_control(posture);
+}
+
+void DynamicThread::unlink() {
+    const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+    DynamicThread **slot = &head;
+    while (*slot != nullptr && *slot != this) slot = &(*slot)->next;
+    if (*slot != nullptr) *slot = next;
+    next = nullptr;
+    tx_interrupt_control(posture);
+}
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+VOID DynamicThread::exitNotify(TX_THREAD *, UINT condition) {
+    if (condition != TX_THREAD_EXIT) return;
+    const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+    exited = exited + 1;
+    tx_interrupt_control(posture);
+}
+
+#endif
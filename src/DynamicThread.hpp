@@ -0,0 +1,98 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef LIBSMART_STM32THREADX_DYNAMICTHREAD_HPP
+#define LIBSMART_STM32THREADX_DYNAMICTHREAD_HPP
+
+#include <libsmart_config.hpp>
+#include "BytePool.hpp"
+#include "Thread.hpp"
+
+namespace Stm32ThreadX {
+    /**
+     * @class DynamicThread
+     * @brief A thread whose stack is allocated from a `BytePool` on creation and returned when it is done.
+     *
+     * `create()` allocates the stack and creates the thread. The stack goes back to the pool
+     *  - in `del()` and in the destructor,
+     *  - in `reclaim()` once the thread has completed or was terminated, and
+     *  - in the next `create()` of the same object, so a transient worker can simply be created again.
+     *
+     * A thread cannot free the stack it runs on, so the release always happens in another thread. Unless
+     * ThreadX is built with `TX_DISABLE_NOTIFY_CALLBACKS`, an exit notification counts finished threads and
+     * `reclaim()` returns at once while there are none. Call `reclaim()` from a housekeeping thread to return
+     * stacks of finished threads whose objects are still alive.
+     */
+    class DynamicThread : public Thread {
+    public:
+        DynamicThread(BytePool &pool, ULONG stackSize, threadEntry func, ULONG param,
+                      priority prio = priority(), const char *name = DEFAULT_NAME)
+            : Thread(nullptr, 0, func, param, prio, name), pool(pool), stackSize(stackSize) { ; }
+
+        DynamicThread(BytePool &pool, ULONG stackSize, threadEntry func, ULONG param,
+                      const attributes &attr, const char *name = DEFAULT_NAME)
+            : Thread(nullptr, 0, func, param, attr, name), pool(pool), stackSize(stackSize) { ; }
+
+        ~DynamicThread() override;
+
+        /**
+         * @brief Allocates the stack and creates the thread.
+         *
+         * A previous run of this object is deleted first. The thread starts suspended unless the attributes
+         * ask for auto-start.
+         *
+         * @return TX_SUCCESS, TX_NO_MEMORY if the pool has no block of the stack size, or the status code of
+         *         `tx_thread_create()`. On failure the stack is returned to the pool.
+         */
+        UINT create();
+
+        /**
+         * @brief Terminates and deletes the thread and returns its stack to the pool.
+         *
+         * Must not be called by the thread itself.
+         */
+        void del();
+
+        /**
+         * @brief Returns the stacks of all dynamic threads that completed or were terminated.
+         *
+         * The threads are deleted, their objects stay valid and can be created again.
+         *
+         * @return The number of stacks returned.
+         */
+        static UINT reclaim();
+
+        /**
+         * @brief Returns true while the thread holds a stack from the pool.
+         */
+        [[nodiscard]] bool hasStack() const { return stack != nullptr; }
+
+    private:
+        void release();
+
+        bool isFinished() const;
+
+        void link();
+
+        void unlink();
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+        static VOID exitNotify(TX_THREAD *thread, UINT condition);
+
+        /** Number of threads that exited since the last `reclaim()`. */
+        static volatile ULONG exited;
+#endif
+
+        /** All dynamic threads that hold a stack. */
+        static DynamicThread *head;
+
+        BytePool &pool;
+        const ULONG stackSize;
+        UCHAR *stack{};
+        DynamicThread *next{};
+    };
+}
+
+#endif //LIBSMART_STM32THREADX_DYNAMICTHREAD_HPP
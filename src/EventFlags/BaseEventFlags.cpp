@@ -4,6 +4,7 @@
  */
 
 #include "BaseEventFlags.hpp"
+#include "LogLevel.hpp"
 
 #if __EXCEPTIONS
 #include <stdexcept>
@@ -27,8 +28,7 @@ return ret;                                                             \
 using namespace Stm32ThreadX;
 
 UINT BaseEventFlags::create(CHAR *name_ptr) {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::BaseEventFlags[%s]::create(\"%s\")\r\n", getName(), name_ptr);
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseEventFlags[%s]::create(\"%s\")\r\n", getName(), name_ptr);
 
     if (isCreated()) return TX_SUCCESS;
 
@@ -43,8 +43,7 @@ UINT BaseEventFlags::create(CHAR *name_ptr) {
 }
 
 UINT BaseEventFlags::del() {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::BaseEventFlags[%s]::del(\"%s\")\r\n", getName());
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseEventFlags[%s]::del(\"%s\")\r\n", getName());
 
     // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_event_flags_delete
     const auto ret = tx_event_flags_delete(this);
@@ -74,9 +73,8 @@ UINT BaseEventFlags::get(ULONG requested_flags, UINT get_option, ULONG *actual_f
 
 UINT BaseEventFlags::info_get(CHAR **name, ULONG *current_flags, TX_THREAD **first_suspended, ULONG *suspended_count,
                               TX_EVENT_FLAGS_GROUP **next_group) {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::BaseEventFlags[%s]::info_get(%p, %p, %p, %p, %p)\r\n", getName(), name,
-                     current_flags, first_suspended, suspended_count, next_group);
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseEventFlags[%s]::info_get(%p, %p, %p, %p, %p)\r\n", getName(), name,
+                            current_flags, first_suspended, suspended_count, next_group);
 
     // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_event_flags_info_get
     const auto ret = tx_event_flags_info_get(this, name, current_flags, first_suspended, suspended_count, next_group);
@@ -89,8 +87,7 @@ UINT BaseEventFlags::info_get(CHAR **name, ULONG *current_flags, TX_THREAD **fir
 }
 
 UINT BaseEventFlags::set(ULONG flags_to_set, UINT set_option) {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::BaseEventFlags[%s]::set(0x%08x, 0x%02x)\r\n", getName(), flags_to_set, set_option);
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseEventFlags[%s]::set(0x%08x, 0x%02x)\r\n", getName(), flags_to_set, set_option);
 
     // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_event_flags_set
     const auto ret = tx_event_flags_set(this, flags_to_set, set_option);
@@ -103,8 +100,7 @@ UINT BaseEventFlags::set(ULONG flags_to_set, UINT set_option) {
 }
 
 UINT BaseEventFlags::set_notify(events_set_notify_cb events_set_notify) {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::BaseEventFlags[%s]::set(%p)\r\n", getName(), events_set_notify);
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseEventFlags[%s]::set(%p)\r\n", getName(), events_set_notify);
 
     // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_event_flags_set_notify
     const auto ret = tx_event_flags_set_notify(this, events_set_notify);
@@ -118,9 +114,8 @@ UINT BaseEventFlags::set_notify(events_set_notify_cb events_set_notify) {
 
 #if defined(TX_EVENT_FLAGS_ENABLE_PERFORMANCE_INFO)
 UINT BaseEventFlags::performance_info_get(ULONG *sets, ULONG *gets, ULONG *suspensions, ULONG *timeouts) {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::BaseEventFlags[%s]::performance_info_get(%p, %p, %p, %p)\r\n", getName(), sets,
-                     gets, suspensions, timeouts);
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseEventFlags[%s]::performance_info_get(%p, %p, %p, %p)\r\n", getName(), sets,
+                            gets, suspensions, timeouts);
 
     // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_event_flags_performance_info_get
     const auto ret = tx_event_flags_performance_info_get(this, sets, gets, suspensions, timeouts);
@@ -133,9 +128,8 @@ UINT BaseEventFlags::performance_info_get(ULONG *sets, ULONG *gets, ULONG *suspe
 }
 
 UINT BaseEventFlags::performance_system_info_get(ULONG *sets, ULONG *gets, ULONG *suspensions, ULONG *timeouts) {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-        ->printf("Stm32ThreadX::BaseEventFlags[%s]::performance_system_info_get(%p, %p, %p, %p)\r\n", getName(), sets,
-                 gets, suspensions, timeouts);
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseEventFlags[%s]::performance_system_info_get(%p, %p, %p, %p)\r\n", getName(), sets,
+                            gets, suspensions, timeouts);
 
     // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_event_flags_performance_system_info_get
     const auto ret = tx_event_flags_performance_system_info_get(sets, gets, suspensions, timeouts);
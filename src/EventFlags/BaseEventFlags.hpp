@@ -162,5 +162,21 @@ namespace Stm32ThreadX {
 #endif
 
         virtual bool isCreated();
+
+        /**
+         * @brief Returns the wrapper that owns a ThreadX control block.
+         *
+         * Notify callbacks registered with `set_notify()` only receive the `TX_EVENT_FLAGS_GROUP` pointer. This maps
+         * it back to the C++ object.
+         *
+         * @param group_ptr A control block that belongs to a `BaseEventFlags`.
+         * @return The owning `BaseEventFlags`.
+         */
+        static BaseEventFlags *fromNative(TX_EVENT_FLAGS_GROUP *group_ptr) {
+            return static_cast<BaseEventFlags *>(group_ptr);
+        }
+
+    private:
+        friend class QueueSet;
     };
 }
@@ -4,6 +4,7 @@
  */
 
 #include "EventFlags.hpp"
+#include "LogLevel.hpp"
 #if __EXCEPTIONS
 #include <stdexcept>
 #endif
@@ -24,27 +25,37 @@ UINT EventFlags::get(const ULONG requestedFlags, getOption_t getOption, waitOpti
 }
 
 UINT EventFlags::get(ULONG requestedFlags, getOption_t getOption, ULONG &actualFlagsRef, waitOption_t waitOption) {
-    actualFlags = 0;
-    const auto ret = BaseEventFlags::get(requestedFlags, static_cast<UINT>(getOption), &actualFlags, waitOption.timeout);
-    actualFlagsRef = actualFlags;
-    return ret;
+    actualFlagsRef = 0;
+    return BaseEventFlags::get(requestedFlags, static_cast<UINT>(getOption), &actualFlagsRef, waitOption.timeout);
 }
 
-UINT EventFlags::get(const ULONG requestedFlags) {
-    return get(requestedFlags, getOption_t::AND, waitOption_t{waitOption_t::NO_WAIT});
+UINT EventFlags::get(const ULONG requestedFlags) const {
+    return isSet(requestedFlags) ? TX_SUCCESS : TX_NO_EVENTS;
 }
 
-ULONG EventFlags::getFlags() {
-    get(0, getOption_t::OR, waitOption_t{waitOption_t::NO_WAIT});
-    return actualFlags;
+ULONG EventFlags::getFlags() const {
+    // Flags cleared by a get while tx_event_flags_set() processes the suspension list are only recorded in
+    // the delayed clear mask until the set call finishes.
+    const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+    const ULONG flags = tx_event_flags_group_current & ~tx_event_flags_group_delayed_clear;
+    tx_interrupt_control(posture);
+    return flags;
 }
 
-bool EventFlags::isSet(const ULONG requestedFlags) {
-    return isSet(requestedFlags, getOption_t::AND);
+bool EventFlags::isSet(const ULONG requestedFlags) const {
+    return (getFlags() & requestedFlags) == requestedFlags;
 }
 
 bool EventFlags::isSet(const ULONG requestedFlags, const getOption_t getOption) {
-    return get(requestedFlags, getOption, waitOption_t{waitOption_t::NO_WAIT}) == TX_SUCCESS;
+    switch (getOption) {
+        case getOption_t::AND:
+            return isSet(requestedFlags);
+        case getOption_t::OR:
+            return (getFlags() & requestedFlags) != 0;
+        default:
+            // The clearing options modify the group, which only the kernel may do
+            return get(requestedFlags, getOption, waitOption_t{waitOption_t::NO_WAIT}) == TX_SUCCESS;
+    }
 }
 
 UINT EventFlags::await(const ULONG requestedFlags) {
@@ -64,10 +75,15 @@ UINT EventFlags::await(const ULONG requestedFlags, const getOption_t getOption)
 }
 
 UINT EventFlags::await(const ULONG requestedFlags, const getOption_t getOption, const waitOption_t waitOption) {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::EventFlags[%s]::await(0x%08x)\r\n", getName(), requestedFlags);
+    ULONG actualFlagsRef{};
+    return await(requestedFlags, getOption, actualFlagsRef, waitOption);
+}
 
-    return get(requestedFlags, getOption, waitOption);
+UINT EventFlags::await(const ULONG requestedFlags, const getOption_t getOption, ULONG &actualFlagsRef,
+                       const waitOption_t waitOption) {
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::EventFlags[%s]::await(0x%08x)\r\n", getName(), requestedFlags);
+
+    return get(requestedFlags, getOption, actualFlagsRef, waitOption);
 }
 
 UINT EventFlags::set(const ULONG flagsToSet, setOption_t setOption) {
@@ -125,44 +125,56 @@ namespace Stm32ThreadX {
          */
         UINT get(ULONG requestedFlags, getOption_t getOption, waitOption_t waitOption);
 
+        /**
+         * @brief Get event flags from event flags group and return the observed flags.
+         *
+         * Same as the overload above. `actualFlagsRef` receives the flags the kernel saw when the request was
+         * satisfied, before any clearing. Every caller passes its own variable, so concurrent waiters do not
+         * share any state.
+         *
+         * @see get(ULONG, getOption_t, waitOption_t)
+         */
         UINT get(ULONG requestedFlags, getOption_t getOption, ULONG &actualFlagsRef, waitOption_t waitOption);
 
         /**
          * @brief Retrieves the current value of the event flag group.
          *
-         * Check the status of all the requested flags and returns immediately.
+         * Check the status of all the requested flags and returns immediately. The control block is read
+         * directly, no kernel service is called.
          *
          * @param requestedFlags The event flags to be retrieved.
          * @return The return value of the method.
          *         - TX_SUCCESS: all requested flags are set
          *         - TX_NO_EVENTS: not all requested flags are set
          */
-        UINT get(ULONG requestedFlags);
+        UINT get(ULONG requestedFlags) const;
 
         using BaseEventFlags::get;
 
         /**
          * @brief Retrieve the current state of the event flags.
          *
-         * This method retrieves the current state of the event flags in the event flags group.
+         * This method retrieves the current state of the event flags in the event flags group. The control block
+         * is read directly with interrupts disabled for a few instructions, no kernel service is called.
+         * Thread and ISR context callable.
          *
          * @return The current state of the event flags.
          *
          * @see EventFlags
          */
-        ULONG getFlags();
+        ULONG getFlags() const;
 
 
         /**
          * @brief Checks if the specified flags are set in the event flags group.
          *
-         * This method checks if the specified flags are set in the event flags group.
+         * This method checks if the specified flags are set in the event flags group, without a kernel call.
          *
          * @param requestedFlags The flags to check.
          *
          * @return True if ALL the specified flags are set in the event flags group, false otherwise.
          */
-        bool isSet(ULONG requestedFlags);
+        bool isSet(ULONG requestedFlags) const;
 
 
         /**
@@ -180,6 +192,8 @@ namespace Stm32ThreadX {
          *                  - getOption_t::OR_CLEAR: Any requested event flag is satisfactory. The event flags that
          *                    satisfy the request are cleared.
          *
+         * AND and OR read the control block directly. Only the clearing options call the kernel.
+         *
          * @return `true` if the requested event flags are set, `false` otherwise.
          */
         bool isSet(ULONG requestedFlags, getOption_t getOption);
@@ -252,6 +266,14 @@ namespace Stm32ThreadX {
          */
         UINT await(ULONG requestedFlags, getOption_t getOption, waitOption_t waitOption);
 
+        /**
+         * @brief Await the specified event flags and return the observed flags.
+         *
+         * @see await(ULONG, getOption_t, waitOption_t)
+         * @see get(ULONG, getOption_t, ULONG &, waitOption_t)
+         */
+        UINT await(ULONG requestedFlags, getOption_t getOption, ULONG &actualFlagsRef, waitOption_t waitOption);
+
 
         /**
          * @brief Enum class representing options for setting event flags.
@@ -330,10 +352,6 @@ namespace Stm32ThreadX {
          * @return Completion status of the operation as a UINT. Returns TX_SUCCESS on success or an error code otherwise.
          */
         UINT clear() { return clear(ULONG_MAX); }
-
-    private:
-        /** Stores the last value of the actual flags returned by get() functions. */
-        ULONG actualFlags = {};
     };
 }
 
@@ -0,0 +1,183 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include "EventFlags.hpp"
+#include "ThreadStats.hpp"
+
+namespace Stm32ThreadX {
+    /**
+     * @struct ReactorEntry
+     * @brief One row of an `EventReactor` dispatch table.
+     */
+    struct ReactorEntry {
+        using handler_fn = void (*)(ULONG flags, void *context);
+
+        /** The event flags that trigger the handler. */
+        ULONG flags;
+        /** Called with the triggering flags that were set. */
+        handler_fn handler;
+        /** Passed to the handler unchanged. */
+        void *context;
+    };
+
+    /**
+     * @struct ReactorStats
+     * @brief Run-time accounting of one `EventReactor` handler.
+     *
+     * Times are in cycles of `ThreadStats::cycles()` if an execution time backend is enabled, see `ThreadStats`,
+     * otherwise in ticks.
+     */
+    struct ReactorStats {
+        /** Number of handler calls. */
+        ULONG calls{};
+        /** Time spent in the handler, summed over all calls. */
+        ULONG64 totalTime{};
+        /** Longest handler call. */
+        ULONG maxTime{};
+    };
+
+    /**
+     * @class EventReactor
+     * @brief Dispatches many event sources from one thread.
+     *
+     * The reactor owns an `EventFlags` group. Its dispatch table is a `static constexpr` array of `ReactorEntry`
+     * passed as template argument, so the table and the mask of all its flags are fixed at compile time. One thread
+     * calls `run()`, which waits for any flag of the table with OR_CLEAR and calls every handler whose flags were
+     * set, in table order. The first row has the highest priority. Event sources only call `signal()`, from thread
+     * or ISR context. This replaces one mostly sleeping thread, and its stack, per source.
+     *
+     * @code
+     * static constexpr ReactorEntry table[] = {{0x01, &onUart, nullptr}, {0x06, &onButtons, &buttons}};
+     * EventReactor<table> reactor("io");
+     * @endcode
+     *
+     * @tparam Table The dispatch table, an array with static storage duration.
+     */
+    template<const auto &Table>
+    class EventReactor {
+        static constexpr std::size_t N = std::extent_v<std::remove_reference_t<decltype(Table)>>;
+        static_assert(std::is_same_v<std::remove_cv_t<std::remove_extent_t<std::remove_reference_t<decltype(Table)>>>,
+                          ReactorEntry>, "EventReactor: the table must be an array of ReactorEntry");
+        static_assert(N > 0, "EventReactor: the table must not be empty");
+
+    public:
+        EventReactor() : EventReactor("Stm32ThreadX::EventReactor") { ; }
+
+        explicit EventReactor(const char *name)
+            : flags(name) { ; }
+
+        /** All flags used by the table. */
+        static constexpr ULONG MASK = [] {
+            ULONG result = 0;
+            for (const auto &entry: Table) result |= entry.flags;
+            return result;
+        }();
+
+        /**
+         * @brief Creates the event flags group.
+         */
+        UINT create() {
+            return flags.create();
+        }
+
+        /**
+         * @brief Deletes the event flags group. A thread blocked in `dispatch()` returns TX_DELETED.
+         */
+        UINT del() {
+            return flags.deleteFlags();
+        }
+
+        /**
+         * @brief Signals events to the reactor thread. Thread and ISR context callable.
+         *
+         * @param eventFlags The flags of the events that occurred.
+         */
+        UINT signal(ULONG eventFlags) {
+            return flags.set(eventFlags);
+        }
+
+        /**
+         * @brief Waits for events once and calls the handlers of all events that occurred.
+         *
+         * @param wait_option The maximum number of ticks to wait, NO_WAIT or WAIT_FOREVER.
+         * @return TX_SUCCESS if handlers were dispatched, TX_NO_EVENTS on timeout, or the status code of the wait.
+         */
+        UINT dispatch(ULONG wait_option) {
+            ULONG occurred{};
+            const auto ret = flags.get(MASK, EventFlags::getOption_t::OR_CLEAR, occurred,
+                                       EventFlags::waitOption_t{wait_option});
+            if (ret != TX_SUCCESS) return ret;
+
+            for (std::size_t i = 0; i < N; ++i) {
+                const auto &entry = Table[i];
+                const auto triggered = occurred & entry.flags;
+                if (triggered == 0) continue;
+
+                const auto start = now();
+                entry.handler(triggered, entry.context);
+                const ULONG elapsed = now() - start;
+
+                auto &handlerStats = stats[i];
+                const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+                ++handlerStats.calls;
+                handlerStats.totalTime += elapsed;
+                if (elapsed > handlerStats.maxTime) handlerStats.maxTime = elapsed;
+                tx_interrupt_control(posture);
+            }
+            return TX_SUCCESS;
+        }
+
+        /**
+         * @brief Dispatches events until the wait fails. Use as the body of the reactor thread.
+         *
+         * @return The status code of the failed wait, e.g. TX_DELETED after `del()` or TX_GROUP_ERROR before
+         *         `create()`.
+         */
+        UINT run() {
+            for (;;) {
+                const auto ret = dispatch(TX_WAIT_FOREVER);
+                // Anything else fails at once again, retrying would spin at the reactor's priority
+                if (ret != TX_SUCCESS && ret != TX_NO_EVENTS) return ret;
+            }
+        }
+
+        /**
+         * @brief Returns a consistent snapshot of the run-time accounting of a table row.
+         */
+        ReactorStats getStats(std::size_t index) const {
+            if (index >= N) return {};
+            const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+            const ReactorStats snapshot = stats[index];
+            tx_interrupt_control(posture);
+            return snapshot;
+        }
+
+        /**
+         * @brief Resets the run-time accounting of all rows.
+         */
+        void resetStats() {
+            const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+            for (auto &handlerStats: stats) handlerStats = ReactorStats();
+            tx_interrupt_control(posture);
+        }
+
+    private:
+        /** The time source of `ReactorStats`. */
+        static ULONG now() {
+#if LIBSMART_STM32THREADX_EXECUTION_TIME
+            return ThreadStats::cycles();
+#else
+            return tx_time_get();
+#endif
+        }
+
+        EventFlags flags;
+        ReactorStats stats[N]{};
+    };
+}
@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <cstring>
+#include "LeanPolicies.hpp"
+#include "tx_api.h"
+
+namespace Stm32ThreadX {
+    /**
+     * @class LeanEventFlags
+     * @brief A final, non-virtual event flags group with inline methods.
+     *
+     * Offers the same services as `BaseEventFlags`, but without a vtable and with the name and logger as optional
+     * policies. With the default `policy::NoName` and `policy::NoLog` an object is exactly a
+     * `TX_EVENT_FLAGS_GROUP`. `get()` returns the observed flags through a caller-provided reference, so
+     * concurrent waiters share no state.
+     *
+     * @tparam NamePolicy `policy::NoName` or `policy::Named`.
+     * @tparam LogPolicy `policy::NoLog` or `policy::Logged`.
+     *
+     * @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_event_flags_create
+     */
+    template<typename NamePolicy = policy::NoName, typename LogPolicy = policy::NoLog>
+    class LeanEventFlags final : protected TX_EVENT_FLAGS_GROUP, public NamePolicy, public LogPolicy {
+    public:
+        explicit LeanEventFlags(const char *name = "Stm32ThreadX::LeanEventFlags",
+                                Stm32ItmLogger::LoggerInterface *logger = &Stm32ItmLogger::emptyLogger)
+            : TX_EVENT_FLAGS_GROUP(), NamePolicy(name), LogPolicy(logger) { ; }
+
+        UINT create() {
+            const auto ret = tx_event_flags_create(this, this->getNameNonConst());
+            if (ret != TX_SUCCESS) {
+                this->logError("Stm32ThreadX::LeanEventFlags[%s]: tx_event_flags_create() = 0x%02x\r\n",
+                               this->getName(), ret);
+            }
+            return ret;
+        }
+
+        UINT del() {
+            const auto ret = tx_event_flags_delete(this);
+            std::memset(static_cast<TX_EVENT_FLAGS_GROUP *>(this), 0, sizeof(TX_EVENT_FLAGS_GROUP));
+            if (ret != TX_SUCCESS) {
+                this->logError("Stm32ThreadX::LeanEventFlags[%s]: tx_event_flags_delete() = 0x%02x\r\n",
+                               this->getName(), ret);
+            }
+            return ret;
+        }
+
+        UINT get(ULONG requested_flags, UINT get_option, ULONG &actual_flags, ULONG wait_option) {
+            return tx_event_flags_get(this, requested_flags, get_option, &actual_flags, wait_option);
+        }
+
+        UINT set(ULONG flags_to_set, UINT set_option) {
+            return tx_event_flags_set(this, flags_to_set, set_option);
+        }
+
+        UINT set(ULONG flags_to_set) {
+            return set(flags_to_set, TX_OR);
+        }
+
+        UINT clear(ULONG flags_to_clear) {
+            return set(~flags_to_clear, TX_AND);
+        }
+    };
+
+    static_assert(sizeof(LeanEventFlags<>) == sizeof(TX_EVENT_FLAGS_GROUP),
+                  "LeanEventFlags<> must be the size of a bare TX_EVENT_FLAGS_GROUP");
+}
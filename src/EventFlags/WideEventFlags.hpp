@@ -0,0 +1,245 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <bitset>
+#include <cstddef>
+#include "EventFlags.hpp"
+
+namespace Stm32ThreadX {
+    /**
+     * @class WideEventFlags
+     * @brief An event flags group with more than 32 flags.
+     *
+     * The flags are kept in a `std::bitset<N>`. A waiter registers its mask and option in one of `MaxWaiters`
+     * slots and sleeps on its own bit of an internal `EventFlags` group. `set()` evaluates the registered
+     * conditions over the whole bitset and wakes only the waiters whose complete condition is met, so a waiter
+     * for an AND over several words is not woken for a partial match. Evaluation happens with interrupts
+     * disabled for a few bitset operations per registered waiter.
+     *
+     * `set()`, `clear()`, `getFlags()` and `isSet()` are thread and ISR context callable.
+     *
+     * @tparam N The number of flags.
+     * @tparam MaxWaiters The number of threads that can wait at the same time, 1 to 32.
+     */
+    template<std::size_t N, std::size_t MaxWaiters = 4>
+    class WideEventFlags {
+        static_assert(N > 0, "WideEventFlags: N must be greater than 0");
+        static_assert(MaxWaiters >= 1 && MaxWaiters <= 32, "WideEventFlags: MaxWaiters must be between 1 and 32");
+
+    public:
+        using mask_t = std::bitset<N>;
+        using getOption_t = EventFlags::getOption_t;
+        using waitOption_t = EventFlags::waitOption_t;
+
+        WideEventFlags() : WideEventFlags("Stm32ThreadX::WideEventFlags") { ; }
+
+        explicit WideEventFlags(const char *name)
+            : wake(name) { ; }
+
+        WideEventFlags(const char *name, Stm32ItmLogger::LoggerInterface *logger)
+            : wake(name, logger) { ; }
+
+        /**
+         * @brief Creates the internal event flags group used to wake waiters.
+         */
+        UINT create() {
+            return wake.create();
+        }
+
+        /**
+         * @brief Deletes the internal event flags group. Waiting threads return TX_DELETED.
+         */
+        UINT del() {
+            return wake.deleteFlags();
+        }
+
+        /**
+         * @brief Sets flags and wakes every waiter whose condition is now met.
+         *
+         * @param flagsToSet The flags to set.
+         * @return TX_SUCCESS, or the status code of waking the waiters.
+         */
+        UINT set(const mask_t &flagsToSet) {
+            ULONG wakeMask = 0;
+
+            const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+            flags |= flagsToSet;
+            for (std::size_t i = 0; i < MaxWaiters; ++i) {
+                auto &waiter = waiters[i];
+                if (!waiter.active || !isSatisfied(flags, waiter.mask, waiter.option)) continue;
+
+                waiter.observed = flags;
+                waiter.satisfied = true;
+                waiter.active = false;
+                if (isClearing(waiter.option)) {
+                    flags &= ~waiter.mask;
+                }
+                wakeMask |= static_cast<ULONG>(1) << i;
+            }
+            tx_interrupt_control(posture);
+
+            return wakeMask != 0 ? wake.set(wakeMask) : TX_SUCCESS;
+        }
+
+        /**
+         * @brief Clears flags. Never wakes a waiter.
+         */
+        UINT clear(const mask_t &flagsToClear) {
+            const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+            flags &= ~flagsToClear;
+            tx_interrupt_control(posture);
+            return TX_SUCCESS;
+        }
+
+        /** Sets a single flag. */
+        UINT setBit(std::size_t bit) {
+            return set(mask_t().set(bit));
+        }
+
+        /** Clears a single flag. */
+        UINT clearBit(std::size_t bit) {
+            return clear(mask_t().set(bit));
+        }
+
+        /**
+         * @brief Returns a snapshot of all flags.
+         */
+        [[nodiscard]] mask_t getFlags() const {
+            const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+            const mask_t snapshot = flags;
+            tx_interrupt_control(posture);
+            return snapshot;
+        }
+
+        /**
+         * @brief Checks the flags against a mask without waiting or clearing.
+         *
+         * @param requestedFlags The flags to check.
+         * @param getOption AND or OR. The clearing options are evaluated like their non-clearing counterpart.
+         */
+        [[nodiscard]] bool isSet(const mask_t &requestedFlags, getOption_t getOption = getOption_t::AND) const {
+            return isSatisfied(getFlags(), requestedFlags, getOption);
+        }
+
+        /**
+         * @brief Waits until the flags satisfy a condition over the whole bitset.
+         *
+         * @param requestedFlags The flags to wait for.
+         * @param getOption AND, OR, AND_CLEAR or OR_CLEAR, as for `EventFlags`. The clearing options clear the
+         *                  requested flags when the condition is met.
+         * @param actualFlags Receives the flags that satisfied the condition, before clearing.
+         * @param waitOption The maximum number of ticks to wait, NO_WAIT or WAIT_FOREVER.
+         * @return TX_SUCCESS, TX_NO_EVENTS on timeout, TX_NO_INSTANCE if all waiter slots are taken, or the status
+         *         code of the internal wait, e.g. TX_DELETED or TX_WAIT_ABORTED.
+         */
+        UINT await(const mask_t &requestedFlags, getOption_t getOption, mask_t &actualFlags, waitOption_t waitOption) {
+            auto posture = tx_interrupt_control(TX_INT_DISABLE);
+            if (isSatisfied(flags, requestedFlags, getOption)) {
+                actualFlags = flags;
+                if (isClearing(getOption)) {
+                    flags &= ~requestedFlags;
+                }
+                tx_interrupt_control(posture);
+                return TX_SUCCESS;
+            }
+            if (waitOption.timeout == waitOption_t::NO_WAIT) {
+                tx_interrupt_control(posture);
+                return TX_NO_EVENTS;
+            }
+
+            std::size_t slot = 0;
+            while (slot < MaxWaiters && (reservedSlots & (static_cast<ULONG>(1) << slot)) != 0) ++slot;
+            if (slot == MaxWaiters) {
+                tx_interrupt_control(posture);
+                return TX_NO_INSTANCE;
+            }
+            const ULONG slotBit = static_cast<ULONG>(1) << slot;
+            auto &waiter = waiters[slot];
+            reservedSlots |= slotBit;
+            waiter.mask = requestedFlags;
+            waiter.option = getOption;
+            waiter.satisfied = false;
+            waiter.active = true;
+            tx_interrupt_control(posture);
+
+            const auto start = tx_time_get();
+            ULONG remaining = waitOption.timeout;
+            UINT ret;
+            for (;;) {
+                ULONG woken{};
+                ret = wake.get(slotBit, getOption_t::OR_CLEAR, woken, waitOption_t{remaining});
+
+                posture = tx_interrupt_control(TX_INT_DISABLE);
+                const bool done = waiter.satisfied;
+                tx_interrupt_control(posture);
+                if (done || ret != TX_SUCCESS) break;
+
+                // A stale wake bit of an earlier waiter in this slot that timed out while being satisfied
+                if (waitOption.timeout != waitOption_t::WAIT_FOREVER) {
+                    const auto elapsed = tx_time_get() - start;
+                    if (elapsed >= waitOption.timeout) {
+                        ret = TX_NO_EVENTS;
+                        break;
+                    }
+                    remaining = waitOption.timeout - elapsed;
+                }
+            }
+
+            // Stop set() from picking this slot before its wake bit is cleared, then release the slot
+            posture = tx_interrupt_control(TX_INT_DISABLE);
+            waiter.active = false;
+            const bool satisfied = waiter.satisfied;
+            if (satisfied) actualFlags = waiter.observed;
+            tx_interrupt_control(posture);
+
+            if (satisfied && ret != TX_SUCCESS && ret != TX_DELETED) {
+                wake.clear(slotBit);
+            }
+
+            posture = tx_interrupt_control(TX_INT_DISABLE);
+            reservedSlots &= ~slotBit;
+            tx_interrupt_control(posture);
+
+            return satisfied ? TX_SUCCESS : ret;
+        }
+
+        /**
+         * @brief Waits until the flags satisfy a condition over the whole bitset.
+         *
+         * @see await(const mask_t &, getOption_t, mask_t &, waitOption_t)
+         */
+        UINT await(const mask_t &requestedFlags, getOption_t getOption, waitOption_t waitOption) {
+            mask_t actualFlags;
+            return await(requestedFlags, getOption, actualFlags, waitOption);
+        }
+
+    private:
+        struct waiter_t {
+            mask_t mask;
+            mask_t observed;
+            getOption_t option{};
+            bool active{};
+            bool satisfied{};
+        };
+
+        static bool isClearing(getOption_t getOption) {
+            return getOption == getOption_t::AND_CLEAR || getOption == getOption_t::OR_CLEAR;
+        }
+
+        static bool isSatisfied(const mask_t &current, const mask_t &requested, getOption_t getOption) {
+            if (getOption == getOption_t::OR || getOption == getOption_t::OR_CLEAR) {
+                return (current & requested).any();
+            }
+            return (current & requested) == requested;
+        }
+
+        EventFlags wake;
+        mask_t flags;
+        waiter_t waiters[MaxWaiters];
+        ULONG reservedSlots{};
+    };
+}
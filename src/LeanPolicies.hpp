@@ -0,0 +1,59 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "Loggable.hpp"
+#include "LogLevel.hpp"
+#include "Nameable.hpp"
+#include "tx_api.h"
+
+namespace Stm32ThreadX {
+    /**
+     * @brief Name and logger policies of the `LeanQueue`, `LeanSemaphore` and `LeanEventFlags` classes.
+     *
+     * The `No*` policies are empty classes, so with both of them a lean object has the size of its bare
+     * ThreadX control block.
+     */
+    namespace policy {
+        /** Objects are created without a name. */
+        class NoName {
+        public:
+            explicit NoName(const char *) { ; }
+
+            static constexpr const char *getName() { return ""; }
+
+            static CHAR *getNameNonConst() { return nullptr; }
+        };
+
+        /** Objects keep a name pointer, which is passed to ThreadX on creation. */
+        class Named : public Stm32Common::Nameable {
+        public:
+            explicit Named(const char *name)
+                : Nameable(name) { ; }
+        };
+
+        /** Errors are returned as status codes only. */
+        class NoLog {
+        public:
+            explicit NoLog(Stm32ItmLogger::LoggerInterface *) { ; }
+
+            template<typename... Args>
+            static void logError(const char *, Args...) { ; }
+        };
+
+        /** Errors of create and delete calls are logged as well. Hot paths never log. */
+        class Logged : public Stm32ItmLogger::Loggable {
+        public:
+            explicit Logged(Stm32ItmLogger::LoggerInterface *logger)
+                : Loggable(logger) { ; }
+
+            template<typename... Args>
+            void logError(const char *fmt, Args... args) {
+                LIBSMART_LOG(ERROR, fmt, args...);
+            }
+        };
+    }
+}
@@ -0,0 +1,42 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef LIBSMART_STM32THREADX_LOGLEVEL_HPP
+#define LIBSMART_STM32THREADX_LOGLEVEL_HPP
+
+#include <libsmart_config.hpp>
+#include "Loggable.hpp"
+
+namespace Stm32ThreadX {
+    /**
+     * @brief Checks at compile time whether log messages of a given severity are compiled in.
+     *
+     * Severities follow the syslog order, where a lower value is more severe. Everything up to and including
+     * `LIBSMART_STM32THREADX_LOG_SEVERITY_MIN` is kept, anything less severe is removed by the compiler.
+     *
+     * @param severity The severity of the log message.
+     * @return True if messages of this severity are compiled in, false otherwise.
+     */
+    constexpr bool isLogEnabled(const Stm32ItmLogger::LoggerInterface::Severity severity) {
+        return static_cast<int>(severity) <= static_cast<int>(
+                   Stm32ItmLogger::LoggerInterface::Severity::LIBSMART_STM32THREADX_LOG_SEVERITY_MIN);
+    }
+}
+
+/**
+ * @brief Logs a printf-style message from within a `Stm32ItmLogger::Loggable`, unless its severity is disabled.
+ *
+ * Disabled severities compile to nothing: neither the logger is dereferenced nor are the arguments evaluated.
+ *
+ * @param severity The name of a `Stm32ItmLogger::LoggerInterface::Severity` enumerator, e.g. DEBUGGING.
+ */
+#define LIBSMART_LOG(severity, ...)                                                                        \
+do {                                                                                                       \
+if constexpr (Stm32ThreadX::isLogEnabled(Stm32ItmLogger::LoggerInterface::Severity::severity)) {           \
+log(Stm32ItmLogger::LoggerInterface::Severity::severity)->printf(__VA_ARGS__);                             \
+}                                                                                                          \
+} while (0)
+
+#endif //LIBSMART_STM32THREADX_LOGLEVEL_HPP
@@ -0,0 +1,149 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cstring>
+#include "BaseMutex.hpp"
+#include "LogLevel.hpp"
+
+#if __EXCEPTIONS
+#include <stdexcept>
+#define LIBSMART_HANDLE_ERROR(fmt, ...)                                          \
+do {                                                                    \
+char buffer[snprintf(nullptr, 0, fmt, __VA_ARGS__) + 1]{};              \
+snprintf(buffer, sizeof(buffer), fmt, __VA_ARGS__);                     \
+log(Stm32ItmLogger::LoggerInterface::Severity::ERROR)->println(buffer); \
+throw std::runtime_error(buffer);                                       \
+} while (0);
+#else
+#define LIBSMART_HANDLE_ERROR(fmt, ...)                                          \
+do {                                                                    \
+char buffer[snprintf(nullptr, 0, fmt, __VA_ARGS__) + 1]{};              \
+snprintf(buffer, sizeof(buffer), fmt, __VA_ARGS__);                     \
+log(Stm32ItmLogger::LoggerInterface::Severity::ERROR)->println(buffer); \
+return ret;                                                             \
+} while (0);
+#endif
+
+using namespace Stm32ThreadX;
+
+UINT BaseMutex::create(CHAR *name_ptr, UINT inherit) {
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseMutex[%s]::create(\"%s\", %d)\r\n",
+                            getName(), name_ptr, inherit);
+
+    // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_mutex_create
+    const auto ret = tx_mutex_create(
+        this,
+        name_ptr,
+        inherit
+    );
+
+    if (ret != TX_SUCCESS) {
+        constexpr char fmt[] = "Stm32ThreadX::BaseMutex[%s]: tx_mutex_create() = 0x%02x";
+        LIBSMART_HANDLE_ERROR(fmt, getName(), ret);
+    }
+    return ret;
+}
+
+UINT BaseMutex::del() {
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseMutex[%s]::del()\r\n", getName());
+
+    // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_mutex_delete
+    const auto ret = tx_mutex_delete(this);
+
+    std::memset(static_cast<TX_MUTEX *>(this), 0, sizeof(TX_MUTEX));
+
+    if (ret != TX_SUCCESS) {
+        constexpr char fmt[] = "Stm32ThreadX::BaseMutex[%s]: tx_mutex_delete() = 0x%02x";
+        LIBSMART_HANDLE_ERROR(fmt, getName(), ret);
+    }
+    return ret;
+}
+
+UINT BaseMutex::get(ULONG wait_option) {
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseMutex[%s]::get()\r\n", getName());
+
+    // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_mutex_get
+    const auto ret = tx_mutex_get(this, wait_option);
+
+    if (ret != TX_SUCCESS && ret != TX_DELETED && ret != TX_NOT_AVAILABLE && ret != TX_WAIT_ABORTED) {
+        constexpr char fmt[] = "Stm32ThreadX::BaseMutex[%s]: tx_mutex_get() = 0x%02x";
+        LIBSMART_HANDLE_ERROR(fmt, getName(), ret);
+    }
+    return ret;
+}
+
+UINT BaseMutex::info_get(CHAR **name, ULONG *count, TX_THREAD **owner, TX_THREAD **first_suspended,
+                         ULONG *suspended_count, TX_MUTEX **next_mutex) {
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseMutex[%s]::info_get()\r\n", getName());
+
+    // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_mutex_info_get
+    const auto ret = tx_mutex_info_get(this, name, count, owner,
+                                       first_suspended, suspended_count, next_mutex);
+
+    if (ret != TX_SUCCESS) {
+        constexpr char fmt[] = "Stm32ThreadX::BaseMutex[%s]: tx_mutex_info_get() = 0x%02x";
+        LIBSMART_HANDLE_ERROR(fmt, getName(), ret);
+    }
+    return ret;
+}
+
+#if defined(TX_MUTEX_ENABLE_PERFORMANCE_INFO)
+UINT BaseMutex::performance_info_get(ULONG *puts, ULONG *gets, ULONG *suspensions, ULONG *timeouts,
+                                     ULONG *inversions, ULONG *inheritances) {
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseMutex[%s]::performance_info_get()\r\n", getName());
+
+    // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_mutex_performance_info_get
+    const auto ret = tx_mutex_performance_info_get(this, puts, gets, suspensions, timeouts,
+                                                   inversions, inheritances);
+
+    if (ret != TX_SUCCESS) {
+        constexpr char fmt[] = "Stm32ThreadX::BaseMutex[%s]: tx_mutex_performance_info_get() = 0x%02x";
+        LIBSMART_HANDLE_ERROR(fmt, getName(), ret);
+    }
+    return ret;
+}
+
+
+UINT BaseMutex::performance_system_info_get(ULONG *puts, ULONG *gets, ULONG *suspensions, ULONG *timeouts,
+                                            ULONG *inversions, ULONG *inheritances) {
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseMutex[%s]::performance_system_info_get()\r\n", getName());
+
+    // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_mutex_performance_system_info_get
+    const auto ret = tx_mutex_performance_system_info_get(puts, gets, suspensions, timeouts,
+                                                          inversions, inheritances);
+
+    if (ret != TX_SUCCESS) {
+        constexpr char fmt[] = "Stm32ThreadX::BaseMutex[%s]: tx_mutex_performance_system_info_get() = 0x%02x";
+        LIBSMART_HANDLE_ERROR(fmt, getName(), ret);
+    }
+    return ret;
+}
+#endif
+
+UINT BaseMutex::prioritize() {
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseMutex[%s]::prioritize()\r\n", getName());
+
+    // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_mutex_prioritize
+    const auto ret = tx_mutex_prioritize(this);
+
+    if (ret != TX_SUCCESS) {
+        constexpr char fmt[] = "Stm32ThreadX::BaseMutex[%s]: tx_mutex_prioritize() = 0x%02x";
+        LIBSMART_HANDLE_ERROR(fmt, getName(), ret);
+    }
+    return ret;
+}
+
+UINT BaseMutex::put() {
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseMutex[%s]::put()\r\n", getName());
+
+    // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_mutex_put
+    const auto ret = tx_mutex_put(this);
+
+    if (ret != TX_SUCCESS) {
+        constexpr char fmt[] = "Stm32ThreadX::BaseMutex[%s]: tx_mutex_put() = 0x%02x";
+        LIBSMART_HANDLE_ERROR(fmt, getName(), ret);
+    }
+    return ret;
+}
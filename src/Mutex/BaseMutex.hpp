@@ -0,0 +1,140 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "Loggable.hpp"
+#include "Nameable.hpp"
+#include "tx_api.h"
+
+namespace Stm32ThreadX {
+    class BaseMutex : protected TX_MUTEX, public Stm32ItmLogger::Loggable, public Stm32Common::Nameable {
+    public:
+        BaseMutex() : BaseMutex(&Stm32ItmLogger::emptyLogger) { ; }
+
+        explicit BaseMutex(const char *name)
+            : BaseMutex(name, &Stm32ItmLogger::emptyLogger) { ; }
+
+        explicit BaseMutex(Stm32ItmLogger::LoggerInterface *logger)
+            : BaseMutex("Stm32ThreadX::Mutex", logger) { ; }
+
+        BaseMutex(const char *name, Stm32ItmLogger::LoggerInterface *logger)
+            : TX_MUTEX(), Loggable(logger), Nameable(name) { ; }
+
+
+        /**
+         * @brief Creates a mutex with the specified name and priority inheritance option.
+         *
+         * This method initializes a mutex using the ThreadX mutex creation API. It logs the creation event
+         * and error messages if the creation fails.
+         *
+         * @param name_ptr A pointer to a character string that represents the name of the mutex.
+         * @param inherit TX_INHERIT to enable priority inheritance, TX_NO_INHERIT to disable it.
+         * @return A UINT value that indicates the success or error code of the operation.
+         *         Returns TX_SUCCESS if the mutex is successfully created, otherwise an error code.
+         */
+        virtual UINT create(CHAR *name_ptr, UINT inherit);
+
+        /**
+         * @brief Deletes the mutex and clears its associated memory.
+         *
+         * This method deletes an existing mutex using the ThreadX mutex deletion API. Threads suspended on
+         * the mutex are resumed with TX_DELETED. The method also clears the memory associated with the mutex
+         * object after deletion.
+         *
+         * @return A UINT value that indicates the success or error code of the operation.
+         *         Returns TX_SUCCESS if the mutex is successfully deleted, otherwise an error code.
+         */
+        virtual UINT del();
+
+        /**
+         * @brief Obtains ownership of the mutex, blocking for a specified time if necessary.
+         *
+         * This method attempts to obtain the mutex using the ThreadX mutex get API. If the calling thread
+         * already owns the mutex, its ownership count is incremented. A timeout (TX_NOT_AVAILABLE), an aborted
+         * wait or a deleted mutex are returned as status codes and are not treated as errors.
+         *
+         * @param wait_option Specifies the maximum time to wait for the mutex.
+         *                    Can be TX_WAIT_FOREVER, TX_NO_WAIT, or a specific timeout value.
+         * @return A UINT value indicating the success or error code of the operation.
+         *         Returns TX_SUCCESS if the mutex is successfully obtained, otherwise an error code.
+         */
+        virtual UINT get(ULONG wait_option);
+
+        /**
+         * @brief Retrieves information about a mutex.
+         *
+         * @param name A pointer to a CHAR pointer to store the name of the mutex.
+         * @param count A pointer to an ULONG to store the ownership count of the mutex.
+         * @param owner A pointer to a TX_THREAD pointer to store the owning thread, if any.
+         * @param first_suspended A pointer to a TX_THREAD pointer to store the first thread suspended on the mutex.
+         * @param suspended_count A pointer to an ULONG to store the number of threads currently suspended on the mutex.
+         * @param next_mutex A pointer to a TX_MUTEX pointer to store the next mutex in the system mutex list.
+         * @return A UINT value that represents the operation's success or error code. Returns TX_SUCCESS if successful,
+         *         or an error code if the operation fails.
+         */
+        virtual UINT info_get(CHAR **name,
+                              ULONG *count,
+                              TX_THREAD **owner,
+                              TX_THREAD **first_suspended,
+                              ULONG *suspended_count,
+                              TX_MUTEX **next_mutex);
+
+#if defined(TX_MUTEX_ENABLE_PERFORMANCE_INFO)
+        /**
+         * @brief Retrieves performance statistics for the mutex.
+         *
+         * @param puts A pointer to a ULONG variable where the number of put operations will be stored.
+         * @param gets A pointer to a ULONG variable where the number of get operations will be stored.
+         * @param suspensions A pointer to a ULONG variable where the number of suspensions will be stored.
+         * @param timeouts A pointer to a ULONG variable where the number of timeouts will be stored.
+         * @param inversions A pointer to a ULONG variable where the number of priority inversions will be stored.
+         * @param inheritances A pointer to a ULONG variable where the number of priority inheritances will be stored.
+         * @return A UINT value that indicates the success or error code of the operation.
+         *         Returns TX_SUCCESS if successful; otherwise, returns an appropriate error code.
+         */
+        virtual UINT performance_info_get(ULONG *puts, ULONG *gets, ULONG *suspensions, ULONG *timeouts,
+                                          ULONG *inversions, ULONG *inheritances);
+
+        /**
+         * @brief Retrieves performance statistics summed over all mutexes.
+         *
+         * @see performance_info_get()
+         */
+        virtual UINT performance_system_info_get(ULONG *puts, ULONG *gets, ULONG *suspensions, ULONG *timeouts,
+                                                 ULONG *inversions, ULONG *inheritances);
+#endif
+
+        /**
+         * @brief Prioritize mutex suspension list.
+         *
+         * This service places the highest priority thread suspended for ownership of the mutex at the front of
+         * the suspension list. All other threads remain in the same FIFO order they were suspended in.
+         *
+         * @return A UINT value indicating the success or error code of the operation.
+         *         Returns TX_SUCCESS if the prioritization is successful, or an applicable error code otherwise.
+         */
+        virtual UINT prioritize();
+
+        /**
+         * @brief Releases ownership of the mutex.
+         *
+         * This method decrements the ownership count of the mutex. When it reaches zero, the mutex is released
+         * and, if priority inheritance raised the owner's priority, the original priority is restored.
+         *
+         * @return A UINT value indicating the result of the mutex release operation.
+         *         Returns TX_SUCCESS if the operation is successful, otherwise an error code.
+         */
+        virtual UINT put();
+
+        /**
+         * @brief Returns the wrapper that owns a ThreadX control block.
+         *
+         * @param mutex_ptr A control block that belongs to a `BaseMutex`.
+         * @return The owning `BaseMutex`.
+         */
+        static BaseMutex *fromNative(TX_MUTEX *mutex_ptr) { return static_cast<BaseMutex *>(mutex_ptr); }
+    };
+}
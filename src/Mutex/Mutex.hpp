@@ -0,0 +1,218 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <chrono>
+#include <libsmart_config.hpp>
+#include "BaseMutex.hpp"
+#include "LogLevel.hpp"
+#include "MutexStats.hpp"
+#include "TickTimer.hpp"
+#include "main.hpp"
+
+namespace Stm32ThreadX {
+    /**
+     * @class BasicMutex
+     * @brief A ThreadX mutex that meets the Lockable and TimedLockable requirements.
+     *
+     * Works with `std::lock_guard`, `std::unique_lock` and `std::scoped_lock`. Priority inheritance is enabled by
+     * default, so a low-priority owner is raised to the priority of the highest thread waiting for the mutex.
+     * Mutexes must not be used from ISR context.
+     *
+     * Use the `Mutex` and `RecursiveMutex` aliases.
+     *
+     * @tparam Recursive If true, the owning thread may lock the mutex again and must unlock it as often. If false,
+     * locking a mutex the calling thread already owns fails with TX_NOT_AVAILABLE instead of nesting.
+     */
+    template<bool Recursive>
+    class BasicMutex : public BaseMutex {
+    public:
+        BasicMutex() = default;
+
+        explicit BasicMutex(const char *name)
+            : BaseMutex(name) { ; }
+
+        explicit BasicMutex(Stm32ItmLogger::LoggerInterface *logger)
+            : BaseMutex(logger) { ; }
+
+        BasicMutex(const char *name, Stm32ItmLogger::LoggerInterface *logger)
+            : BaseMutex(name, logger) { ; }
+
+        using BaseMutex::create;
+
+        /**
+         * @brief Creates the mutex.
+         *
+         * @param inherit TX_INHERIT (default) to enable priority inheritance, TX_NO_INHERIT to disable it.
+         * @return The status code of `tx_mutex_create()`.
+         */
+        UINT create(UINT inherit = TX_INHERIT) {
+            return BaseMutex::create(getNameNonConst(), inherit);
+        }
+
+        UINT get(ULONG wait_option) override {
+            if constexpr (!Recursive) {
+                if (isOwnedByCaller()) {
+                    LIBSMART_LOG(ERROR, "Stm32ThreadX::Mutex[%s]: locked again by its owner\r\n", getName());
+                    return TX_NOT_AVAILABLE;
+                }
+            }
+#if LIBSMART_STM32THREADX_MUTEX_STATS
+            const auto start = tx_time_get();
+            const bool contended = tx_mutex_ownership_count != 0 && !isOwnedByCaller();
+            const auto ret = BaseMutex::get(wait_option);
+            recordGet(start, contended, ret);
+            return ret;
+#else
+            return BaseMutex::get(wait_option);
+#endif
+        }
+
+        UINT put() override {
+#if LIBSMART_STM32THREADX_MUTEX_STATS
+            if (tx_mutex_ownership_count == 1 && isOwnedByCaller()) {
+                recordRelease();
+            }
+#endif
+            return BaseMutex::put();
+        }
+
+        /**
+         * @brief Blocks until the mutex is obtained.
+         *
+         * Locking can only fail on a programming error: a non-recursive mutex locked again by its owner, a mutex
+         * that was not created or deleted, or an aborted wait. This asserts. Without assertions the failed lock is
+         * remembered, so the matching `unlock()` does not release a lock the caller never got.
+         */
+        void lock() {
+            const auto ret = get(TX_WAIT_FOREVER);
+            if (ret == TX_SUCCESS) return;
+
+            LIBSMART_LOG(ERROR, "Stm32ThreadX::Mutex[%s]::lock() = 0x%02x\r\n", getName(), ret);
+            assert_param(ret == TX_SUCCESS);
+            // Only the owner can unlock, so for anyone else the next unlock() is a no-op anyway
+            if (isOwnedByCaller()) failedLocks = failedLocks + 1;
+        }
+
+        /**
+         * @brief Obtains the mutex if it is free.
+         *
+         * @return True if the mutex was obtained.
+         */
+        bool try_lock() {
+            return get(TX_NO_WAIT) == TX_SUCCESS;
+        }
+
+        /**
+         * @brief Tries to obtain the mutex for at most the given time, rounded up to whole ticks.
+         *
+         * @param timeout The maximum time to wait, e.g. `tick_timer::duration` or `std::chrono::milliseconds`.
+         * @return True if the mutex was obtained.
+         */
+        template<class Rep, class Period>
+        bool try_lock_for(const std::chrono::duration<Rep, Period> &timeout) {
+            if (timeout <= timeout.zero()) return try_lock();
+            return get(toTicks(std::chrono::ceil<tick_timer::duration>(timeout))) == TX_SUCCESS;
+        }
+
+        /**
+         * @brief Tries to obtain the mutex until the tick counter reaches the deadline.
+         *
+         * @param deadline The latest time to obtain the mutex. Tick counter wrap-around is handled.
+         * @return True if the mutex was obtained.
+         */
+        bool try_lock_until(const tick_timer::time_point &deadline) {
+            const auto remaining = static_cast<LONG>(toTicks(deadline) - tx_time_get());
+            if (remaining <= 0) return try_lock();
+            return get(static_cast<ULONG>(remaining)) == TX_SUCCESS;
+        }
+
+        /**
+         * @brief Releases the mutex.
+         *
+         * Does nothing but log an error if the calling thread does not own the mutex, or if it pairs with a
+         * `lock()` that failed.
+         */
+        void unlock() {
+            if (!isOwnedByCaller()) {
+                LIBSMART_LOG(ERROR, "Stm32ThreadX::Mutex[%s]::unlock() by a thread that is not the owner\r\n",
+                             getName());
+                return;
+            }
+            if (failedLocks != 0) {
+                failedLocks = failedLocks - 1;
+                return;
+            }
+            put();
+        }
+
+#if LIBSMART_STM32THREADX_MUTEX_STATS
+        /**
+         * @brief Returns a consistent snapshot of the hold and wait time statistics.
+         */
+        MutexStats getStats() {
+            const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+            const MutexStats snapshot = stats;
+            tx_interrupt_control(posture);
+            return snapshot;
+        }
+
+        /**
+         * @brief Resets the hold and wait time statistics.
+         */
+        void resetStats() {
+            const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+            stats = MutexStats();
+            tx_interrupt_control(posture);
+        }
+#endif
+
+    private:
+        bool isOwnedByCaller() const {
+            return tx_mutex_ownership_count != 0 && tx_mutex_owner == tx_thread_identify();
+        }
+
+        /** Failed `lock()` calls of the owner that its `unlock()` calls must skip. Touched by the owner only. */
+        ULONG failedLocks{};
+
+#if LIBSMART_STM32THREADX_MUTEX_STATS
+        void recordGet(ULONG start, bool contended, UINT ret) {
+            const auto now = tx_time_get();
+
+            const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+            if (ret != TX_SUCCESS) {
+                ++stats.failures;
+            } else if (tx_mutex_ownership_count == 1) {
+                const auto waited = now - start;
+                ++stats.acquisitions;
+                if (contended) ++stats.contentions;
+                stats.totalWaitTicks += waited;
+                if (waited > stats.maxWaitTicks) stats.maxWaitTicks = waited;
+                acquiredAt = now;
+            }
+            tx_interrupt_control(posture);
+        }
+
+        void recordRelease() {
+            const auto held = tx_time_get() - acquiredAt;
+
+            const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+            stats.totalHoldTicks += held;
+            if (held > stats.maxHoldTicks) stats.maxHoldTicks = held;
+            tx_interrupt_control(posture);
+        }
+
+        ULONG acquiredAt{};
+        MutexStats stats{};
+#endif
+    };
+
+    /** A non-recursive mutex with priority inheritance. */
+    using Mutex = BasicMutex<false>;
+
+    /** A recursive mutex with priority inheritance. */
+    using RecursiveMutex = BasicMutex<true>;
+}
@@ -0,0 +1,34 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "tx_api.h"
+
+namespace Stm32ThreadX {
+    /**
+     * @struct MutexStats
+     * @brief Snapshot of the hold and wait time statistics of a `Mutex`.
+     *
+     * Only recorded when `LIBSMART_STM32THREADX_MUTEX_STATS` is set. Nested locks of a `RecursiveMutex` count
+     * as one acquisition, held from the outermost lock to the matching unlock.
+     */
+    struct MutexStats {
+        /** Number of times the mutex was obtained. */
+        ULONG acquisitions{};
+        /** Number of acquisitions that found the mutex owned by another thread. */
+        ULONG contentions{};
+        /** Number of lock attempts that timed out or were aborted. */
+        ULONG failures{};
+        /** Ticks spent waiting for the mutex, summed over all acquisitions. */
+        ULONG totalWaitTicks{};
+        /** Longest wait for the mutex, in ticks. */
+        ULONG maxWaitTicks{};
+        /** Ticks the mutex was held, summed over all acquisitions. */
+        ULONG totalHoldTicks{};
+        /** Longest time the mutex was held, in ticks. */
+        ULONG maxHoldTicks{};
+    };
+}
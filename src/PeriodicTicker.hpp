@@ -0,0 +1,90 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "Thread.hpp"
+#include "TickTimer.hpp"
+
+namespace Stm32ThreadX {
+    /**
+     * @class PeriodicTicker
+     * @brief Paces a fixed-rate loop on absolute deadlines.
+     *
+     * Every `wait()` sleeps until the next multiple of the period after the start time, so the loop keeps its
+     * phase no matter how long each iteration takes. If an iteration overruns one or more periods, the missed
+     * periods are skipped instead of being run back to back, and counted.
+     *
+     * @code
+     * PeriodicTicker ticker(std::chrono::milliseconds(10));
+     * for (;;) {
+     *     ticker.wait();
+     *     sample();
+     * }
+     * @endcode
+     */
+    class PeriodicTicker {
+    public:
+        explicit PeriodicTicker(tick_timer::duration period)
+            : PeriodicTicker(period, tick_timer64::now()) { ; }
+
+        template<class Rep, class Period>
+        explicit PeriodicTicker(const std::chrono::duration<Rep, Period> &period)
+            : PeriodicTicker(std::chrono::ceil<tick_timer::duration>(period)) { ; }
+
+        /**
+         * @param period The loop period, at least one tick.
+         * @param start The time of tick 0. The first `wait()` returns one period later.
+         */
+        PeriodicTicker(tick_timer::duration period, tick_timer64::time_point start)
+            : period(period.count() > 0 ? period.count() : 1), next(start) { ; }
+
+        /**
+         * @brief Sleeps until the next period starts.
+         *
+         * @return The number of periods that were skipped because the caller was late, 0 if on time.
+         */
+        ULONG wait() {
+            next += period;
+            ULONG missed = 0;
+
+            const auto now = tick_timer64::now();
+            if (next < now) {
+                // Skip to the first deadline that is still ahead instead of catching up
+                const auto late = static_cast<tick_timer64::rep>((now - next).count());
+                const auto skip = late / period.count() + 1;
+                next += period * skip;
+                missed = static_cast<ULONG>(skip);
+                overruns += missed;
+            }
+
+            this_thread::sleepUntil(next);
+            return missed;
+        }
+
+        /**
+         * @brief Restarts the schedule at a new start time and clears the overrun counter.
+         */
+        void reset(tick_timer64::time_point start = tick_timer64::now()) {
+            next = start;
+            overruns = 0;
+        }
+
+        /**
+         * @brief Returns the deadline the last `wait()` slept until.
+         */
+        [[nodiscard]] tick_timer64::time_point getDeadline() const { return next; }
+
+        /**
+         * @brief Returns the total number of skipped periods since construction or `reset()`.
+         */
+        [[nodiscard]] ULONG getOverruns() const { return overruns; }
+
+    private:
+        const tick_timer64::duration period;
+        tick_timer64::time_point next;
+        ULONG overruns{};
+    };
+}
@@ -4,6 +4,7 @@
  */
 
 #include "BaseQueue.hpp"
+#include "LogLevel.hpp"
 #include <ctime>
 
 #if __EXCEPTIONS
@@ -28,9 +29,8 @@ return ret;                                                             \
 using namespace Stm32ThreadX;
 
 UINT BaseQueue::create(CHAR *name_ptr, UINT message_size, void *queue_start, ULONG queue_size) {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::BaseQueue[%s]::create(\"%s\", %d, %p, %lu)\r\n",
-                     getName(), name_ptr, message_size, queue_start, queue_size);
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseQueue[%s]::create(\"%s\", %d, %p, %lu)\r\n",
+                            getName(), name_ptr, message_size, queue_start, queue_size);
 
     // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_queue_create
     const auto ret = tx_queue_create(
@@ -49,8 +49,7 @@ UINT BaseQueue::create(CHAR *name_ptr, UINT message_size, void *queue_start, ULO
 }
 
 UINT BaseQueue::del() {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::BaseQueue[%s]::del()\r\n", getName());
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseQueue[%s]::del()\r\n", getName());
 
     // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_queue_delete
     const auto ret = tx_queue_delete(this);
@@ -65,8 +64,7 @@ UINT BaseQueue::del() {
 }
 
 UINT BaseQueue::flush() {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::BaseQueue[%s]::flush()\r\n", getName());
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseQueue[%s]::flush()\r\n", getName());
 
     // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_queue_flush
     const auto ret = tx_queue_flush(this);
@@ -79,9 +77,8 @@ UINT BaseQueue::flush() {
 }
 
 UINT BaseQueue::front_send(void *source_ptr, ULONG wait_option) {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::BaseQueue[%s]::front_send(%p, %lu)\r\n",
-                     getName(), source_ptr, wait_option);
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseQueue[%s]::front_send(%p, %lu)\r\n",
+                            getName(), source_ptr, wait_option);
 
     // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_queue_front_send
     const auto ret = tx_queue_front_send(
@@ -125,9 +122,8 @@ UINT BaseQueue::info_get(CHAR **name, ULONG *enqueued, ULONG *available_storage,
 #if defined(TX_QUEUE_ENABLE_PERFORMANCE_INFO)
 UINT BaseQueue::performance_info_get(ULONG *messages_sent, ULONG *messages_received, ULONG *empty_suspensions,
                                      ULONG *full_suspensions, ULONG *full_errors, ULONG *timeouts) {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::BaseQueue[%s]::performance_info_get()\r\n",
-                     getName());
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseQueue[%s]::performance_info_get()\r\n",
+                            getName());
 
     // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_queue_performance_info_get
     const auto ret = tx_queue_performance_info_get(
@@ -150,9 +146,8 @@ UINT BaseQueue::performance_info_get(ULONG *messages_sent, ULONG *messages_recei
 
 UINT BaseQueue::performance_system_info_get(ULONG *messages_sent, ULONG *messages_received, ULONG *empty_suspensions,
                                             ULONG *full_suspensions, ULONG *full_errors, ULONG *timeouts) {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::BaseQueue[%s]::performance_system_info_get()\r\n",
-                     getName());
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseQueue[%s]::performance_system_info_get()\r\n",
+                            getName());
 
     // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_queue_performance_system_info_get
     const auto ret = tx_queue_performance_system_info_get(
@@ -174,9 +169,8 @@ UINT BaseQueue::performance_system_info_get(ULONG *messages_sent, ULONG *message
 
 
 UINT BaseQueue::prioritize() {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::BaseQueue[%s]::prioritize()\r\n",
-                     getName());
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseQueue[%s]::prioritize()\r\n",
+                            getName());
 
     // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_queue_prioritize
     const auto ret = tx_queue_prioritize(
@@ -210,9 +204,8 @@ UINT BaseQueue::receive(void *destination_ptr, ULONG wait_option) {
 }
 
 UINT BaseQueue::send(void *source_ptr, ULONG wait_option) {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::BaseQueue[%s]::send(%p, %lu)\r\n",
-                     getName(), source_ptr, wait_option);
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseQueue[%s]::send(%p, %lu)\r\n",
+                            getName(), source_ptr, wait_option);
 
     // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_queue_send
     const auto ret = tx_queue_send(
@@ -229,9 +222,8 @@ UINT BaseQueue::send(void *source_ptr, ULONG wait_option) {
 }
 
 UINT BaseQueue::send_notify(send_notify_callback queue_send_notify) {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::BaseQueue[%s]::send(%p)\r\n",
-                     getName(), queue_send_notify);
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseQueue[%s]::send(%p)\r\n",
+                            getName(), queue_send_notify);
 
     // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_queue_send_notify
     const auto ret = tx_queue_send_notify(
@@ -221,5 +221,19 @@ namespace Stm32ThreadX {
          * if the operation is successful, or an error code denoting any issues.
          */
         virtual UINT send_notify(send_notify_callback queue_send_notify);
+
+        /**
+         * @brief Returns the wrapper that owns a ThreadX control block.
+         *
+         * Notify callbacks registered with `send_notify()` only receive the `TX_QUEUE` pointer. This maps it back
+         * to the C++ object.
+         *
+         * @param queue_ptr A control block that belongs to a `BaseQueue`.
+         * @return The owning `BaseQueue`.
+         */
+        static BaseQueue *fromNative(TX_QUEUE *queue_ptr) { return static_cast<BaseQueue *>(queue_ptr); }
+
+    private:
+        friend class QueueSet;
     };
 }
@@ -0,0 +1,93 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <cstddef>
+#include "StaticQueue.hpp"
+
+namespace Stm32ThreadX {
+    /**
+     * @class ConflatingQueue
+     * @brief A `StaticQueue` that drops its oldest message instead of failing when it is full.
+     *
+     * Meant for telemetry streams where only the newest samples matter. `send()` never blocks and never returns
+     * TX_QUEUE_FULL: if there is no space, the oldest message is removed and counted as an overwrite. Memory and
+     * latency stay bounded when the consumer falls behind, and the consumer still blocks in `tx_queue_receive()`
+     * while there is no data.
+     *
+     * @tparam T The message type, see `StaticQueue`.
+     * @tparam Depth The number of messages kept.
+     */
+    template<typename T, std::size_t Depth>
+    class ConflatingQueue : public StaticQueue<T, Depth> {
+        using queue_t = StaticQueue<T, Depth>;
+
+    public:
+        ConflatingQueue() = default;
+
+        explicit ConflatingQueue(const char *name)
+            : queue_t(name) { ; }
+
+        explicit ConflatingQueue(Stm32ItmLogger::LoggerInterface *logger)
+            : queue_t(logger) { ; }
+
+        ConflatingQueue(const char *name, Stm32ItmLogger::LoggerInterface *logger)
+            : queue_t(name, logger) { ; }
+
+        /**
+         * @brief Sends a message, overwriting the oldest message if the queue is full.
+         *
+         * Thread and ISR context callable.
+         *
+         * @param message The message to send.
+         *
+         * @return TX_SUCCESS, or the status code of `tx_queue_send()` if it failed for another reason than a full
+         * queue.
+         */
+        UINT send(const T &message) {
+            for (;;) {
+                const auto ret = queue_t::send(message, TX_NO_WAIT);
+                if (ret != TX_QUEUE_FULL) return ret;
+
+                // Raw words, so T does not have to be default-constructible
+                ULONG dropped[sizeof(T) / sizeof(ULONG)];
+                if (tx_queue_receive(this, dropped, TX_NO_WAIT) == TX_SUCCESS) {
+                    const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+                    overwrites = overwrites + 1;
+                    tx_interrupt_control(posture);
+                }
+            }
+        }
+
+        /**
+         * @brief Returns the number of messages dropped to make room for newer ones.
+         */
+        [[nodiscard]] ULONG getOverwrites() const {
+            return overwrites;
+        }
+
+        /**
+         * @brief Resets the overwrite counter.
+         */
+        void resetOverwrites() {
+            overwrites = 0;
+        }
+
+    private:
+        using queue_t::front_send;
+
+        volatile ULONG overwrites{};
+    };
+
+    /**
+     * @brief A conflating queue holding just the latest value.
+     *
+     * Every `send()` replaces a value the consumer has not picked up yet. `receive()` blocks until a new value
+     * arrives.
+     */
+    template<typename T>
+    using Mailbox = ConflatingQueue<T, 1>;
+}
@@ -0,0 +1,169 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include "QueueStats.hpp"
+#include "StaticQueue.hpp"
+
+namespace Stm32ThreadX {
+    namespace detail {
+        /** Smallest ThreadX message size in ULONG words that holds `words` words. */
+        constexpr UINT instrumentedMessageWords(std::size_t words) {
+            return words <= 1 ? 1 : words <= 2 ? 2 : words <= 4 ? 4 : words <= 8 ? 8 : 16;
+        }
+
+        template<UINT Words>
+        struct InstrumentedEnvelope {
+            ULONG words[Words];
+        };
+    }
+
+    /**
+     * @class InstrumentedQueue
+     * @brief A `StaticQueue` variant that records depth and latency statistics.
+     *
+     * Each message carries its enqueue tick in one extra ULONG word, so `T` may use at most 15 words. Send and
+     * receive calls are timed with `tx_time_get()`, and the results are added to the fixed-size log2 histograms
+     * of a `QueueStats` snapshot. Use `StaticQueue` where the extra word and timing are not wanted.
+     *
+     * The enqueue tick is taken when a send call starts, so the residency of a message that had to wait for space
+     * includes that wait.
+     *
+     * @tparam T The message type. Must be trivially copyable.
+     * @tparam Depth The number of messages the queue can hold.
+     */
+    template<typename T, std::size_t Depth>
+    class InstrumentedQueue
+            : protected StaticQueue<detail::InstrumentedEnvelope<
+                detail::instrumentedMessageWords((sizeof(T) + sizeof(ULONG) - 1) / sizeof(ULONG) + 1)>, Depth> {
+        static_assert(std::is_trivially_copyable<T>::value, "InstrumentedQueue: T must be trivially copyable");
+        static_assert(sizeof(T) <= 15 * sizeof(ULONG), "InstrumentedQueue: T must not exceed 15 ULONG words");
+
+        static constexpr UINT WORDS =
+                detail::instrumentedMessageWords((sizeof(T) + sizeof(ULONG) - 1) / sizeof(ULONG) + 1);
+
+        using envelope_t = detail::InstrumentedEnvelope<WORDS>;
+        using queue_t = StaticQueue<envelope_t, Depth>;
+
+    public:
+        using value_type = T;
+
+        InstrumentedQueue() = default;
+
+        explicit InstrumentedQueue(const char *name)
+            : queue_t(name) { ; }
+
+        explicit InstrumentedQueue(Stm32ItmLogger::LoggerInterface *logger)
+            : queue_t(logger) { ; }
+
+        InstrumentedQueue(const char *name, Stm32ItmLogger::LoggerInterface *logger)
+            : queue_t(name, logger) { ; }
+
+        using queue_t::create;
+        using queue_t::del;
+        using queue_t::flush;
+        using queue_t::getName;
+
+        /**
+         * @brief Sends a message to the back of the queue and records its statistics.
+         *
+         * @see StaticQueue::send()
+         */
+        UINT send(const T &message, ULONG wait_option) {
+            envelope_t envelope;
+            const auto start = pack(envelope, message);
+            const auto ret = queue_t::send(envelope, wait_option);
+            recordSend(start, ret);
+            return ret;
+        }
+
+        /**
+         * @brief Sends a message to the front of the queue and records its statistics.
+         *
+         * @see StaticQueue::front_send()
+         */
+        UINT front_send(const T &message, ULONG wait_option) {
+            envelope_t envelope;
+            const auto start = pack(envelope, message);
+            const auto ret = queue_t::front_send(envelope, wait_option);
+            recordSend(start, ret);
+            return ret;
+        }
+
+        /**
+         * @brief Receives a message and records its statistics.
+         *
+         * @see StaticQueue::receive()
+         */
+        UINT receive(T &message, ULONG wait_option) {
+            envelope_t envelope;
+            const auto start = tx_time_get();
+            const auto ret = queue_t::receive(envelope, wait_option);
+            const auto now = tx_time_get();
+
+            const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+            ++stats.receiverBlockTicks[QueueStats::bucketOf(now - start)];
+            if (ret == TX_SUCCESS) {
+                ++stats.received;
+                ++stats.residencyTicks[QueueStats::bucketOf(now - envelope.words[WORDS - 1])];
+            }
+            tx_interrupt_control(posture);
+
+            if (ret == TX_SUCCESS) {
+                std::memcpy(&message, envelope.words, sizeof(T));
+            }
+            return ret;
+        }
+
+        /**
+         * @brief Returns a consistent snapshot of the statistics.
+         */
+        QueueStats getStats() {
+            const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+            QueueStats snapshot = stats;
+            snapshot.depth = this->tx_queue_enqueued;
+            tx_interrupt_control(posture);
+            return snapshot;
+        }
+
+        /**
+         * @brief Resets all counters and histograms. The high-water mark restarts at the current depth.
+         */
+        void resetStats() {
+            const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+            stats = QueueStats();
+            stats.highWaterMark = this->tx_queue_enqueued;
+            tx_interrupt_control(posture);
+        }
+
+    private:
+        static ULONG pack(envelope_t &envelope, const T &message) {
+            std::memcpy(envelope.words, &message, sizeof(T));
+            const auto now = tx_time_get();
+            envelope.words[WORDS - 1] = now;
+            return now;
+        }
+
+        void recordSend(ULONG start, UINT ret) {
+            const auto now = tx_time_get();
+
+            const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+            ++stats.senderBlockTicks[QueueStats::bucketOf(now - start)];
+            if (ret == TX_SUCCESS) {
+                ++stats.sent;
+                if (this->tx_queue_enqueued > stats.highWaterMark) {
+                    stats.highWaterMark = this->tx_queue_enqueued;
+                }
+            }
+            tx_interrupt_control(posture);
+        }
+
+        QueueStats stats{};
+    };
+}
@@ -0,0 +1,83 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <cstring>
+#include "LeanPolicies.hpp"
+#include "tx_api.h"
+
+namespace Stm32ThreadX {
+    /**
+     * @class LeanQueue
+     * @brief A final, non-virtual message queue with inline methods.
+     *
+     * Offers the same services as `BaseQueue`, but without a vtable and with the name and logger as optional
+     * policies. With the default `policy::NoName` and `policy::NoLog` an object is exactly a `TX_QUEUE`. Use it
+     * where many queues are needed and nothing is overridden. Hot paths never log, errors are returned as status
+     * codes.
+     *
+     * @tparam NamePolicy `policy::NoName` or `policy::Named`.
+     * @tparam LogPolicy `policy::NoLog` or `policy::Logged`.
+     *
+     * @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_queue_create
+     */
+    template<typename NamePolicy = policy::NoName, typename LogPolicy = policy::NoLog>
+    class LeanQueue final : protected TX_QUEUE, public NamePolicy, public LogPolicy {
+    public:
+        explicit LeanQueue(const char *name = "Stm32ThreadX::LeanQueue",
+                           Stm32ItmLogger::LoggerInterface *logger = &Stm32ItmLogger::emptyLogger)
+            : TX_QUEUE(), NamePolicy(name), LogPolicy(logger) { ; }
+
+        UINT create(UINT message_size, VOID *queue_start, ULONG queue_size) {
+            const auto ret = tx_queue_create(this, this->getNameNonConst(), message_size, queue_start, queue_size);
+            if (ret != TX_SUCCESS) {
+                this->logError("Stm32ThreadX::LeanQueue[%s]: tx_queue_create() = 0x%02x\r\n", this->getName(), ret);
+            }
+            return ret;
+        }
+
+        UINT del() {
+            const auto ret = tx_queue_delete(this);
+            std::memset(static_cast<TX_QUEUE *>(this), 0, sizeof(TX_QUEUE));
+            if (ret != TX_SUCCESS) {
+                this->logError("Stm32ThreadX::LeanQueue[%s]: tx_queue_delete() = 0x%02x\r\n", this->getName(), ret);
+            }
+            return ret;
+        }
+
+        UINT send(VOID *source_ptr, ULONG wait_option) {
+            return tx_queue_send(this, source_ptr, wait_option);
+        }
+
+        UINT front_send(VOID *source_ptr, ULONG wait_option) {
+            return tx_queue_front_send(this, source_ptr, wait_option);
+        }
+
+        UINT receive(VOID *destination_ptr, ULONG wait_option) {
+            return tx_queue_receive(this, destination_ptr, wait_option);
+        }
+
+        UINT flush() {
+            return tx_queue_flush(this);
+        }
+
+        /**
+         * @brief Returns the number of messages in the queue, without a kernel call.
+         */
+        [[nodiscard]] ULONG getEnqueued() const {
+            return tx_queue_enqueued;
+        }
+
+        /**
+         * @brief Returns the number of free message slots, without a kernel call.
+         */
+        [[nodiscard]] ULONG getAvailable() const {
+            return tx_queue_available_storage;
+        }
+    };
+
+    static_assert(sizeof(LeanQueue<>) == sizeof(TX_QUEUE), "LeanQueue<> must be the size of a bare TX_QUEUE");
+}
@@ -0,0 +1,161 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <cstddef>
+#include "StaticQueue.hpp"
+#include "Semaphore/Semaphore.hpp"
+
+namespace Stm32ThreadX {
+    /**
+     * @class PriorityQueue
+     * @brief A message queue with several priority levels and one blocking receive over all of them.
+     *
+     * Every level is a `StaticQueue`. A counting semaphore counts the messages over all levels, so a receiver
+     * sleeps in a single `tx_semaphore_get()` no matter which level the next message arrives on. A bitmap of
+     * non-empty levels lets the receiver find the most urgent level in O(1). Level 0 is the most urgent level,
+     * like ThreadX thread priorities. Messages on the same level are received in FIFO order.
+     *
+     * @tparam T The message type, see `StaticQueue`.
+     * @tparam Levels The number of priority levels, 1 to 32.
+     * @tparam DepthPerLevel The number of messages each level can hold.
+     */
+    template<typename T, std::size_t Levels, std::size_t DepthPerLevel>
+    class PriorityQueue {
+        static_assert(Levels >= 1 && Levels <= 32, "PriorityQueue: Levels must be between 1 and 32");
+
+    public:
+        using value_type = T;
+
+        static constexpr std::size_t LEVELS = Levels;
+
+        PriorityQueue() : PriorityQueue("Stm32ThreadX::PriorityQueue") { ; }
+
+        explicit PriorityQueue(const char *name)
+            : PriorityQueue(name, &Stm32ItmLogger::emptyLogger) { ; }
+
+        PriorityQueue(const char *name, Stm32ItmLogger::LoggerInterface *logger)
+            : available(name, logger) {
+            for (auto &level: levels) {
+                level.setName(name);
+            }
+        }
+
+        /**
+         * @brief Creates the level queues and the counting semaphore.
+         *
+         * @return TX_SUCCESS, or the status code of the first creation that failed.
+         */
+        UINT create() {
+            for (auto &level: levels) {
+                const auto ret = level.create();
+                if (ret != TX_SUCCESS) return ret;
+            }
+            return available.create(available.getNameNonConst(), 0);
+        }
+
+        /**
+         * @brief Deletes the level queues and the counting semaphore.
+         *
+         * @return TX_SUCCESS, or the status code of the last deletion that failed.
+         */
+        UINT del() {
+            UINT ret = available.del();
+            for (auto &level: levels) {
+                const auto levelRet = level.del();
+                if (levelRet != TX_SUCCESS) ret = levelRet;
+            }
+            nonEmptyLevels = 0;
+            return ret;
+        }
+
+        /**
+         * @brief Sends a message on a priority level.
+         *
+         * @param message The message to send.
+         * @param level The priority level, 0 being the most urgent.
+         * @param wait_option Amount of time, in ticks, to suspend if that level is full.
+         *
+         * @return TX_SUCCESS, TX_OPTION_ERROR for an invalid level, or the status code of the level's
+         * `tx_queue_send()`.
+         */
+        UINT send(const T &message, UINT level, ULONG wait_option) {
+            if (level >= Levels) return TX_OPTION_ERROR;
+
+            const auto ret = levels[level].send(message, wait_option);
+            if (ret != TX_SUCCESS) return ret;
+
+            const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+            nonEmptyLevels = nonEmptyLevels | (1UL << level);
+            tx_interrupt_control(posture);
+
+            return available.put();
+        }
+
+        /**
+         * @brief Receives the oldest message of the most urgent non-empty level.
+         *
+         * @param message Receives the message.
+         * @param wait_option Amount of time, in ticks, to suspend while all levels are empty.
+         * @param level Optional pointer that receives the level the message came from.
+         *
+         * @return TX_SUCCESS, or the status code of the semaphore get that failed, e.g. TX_NO_INSTANCE on timeout.
+         */
+        UINT receive(T &message, ULONG wait_option, UINT *level = nullptr) {
+            const auto ret = available.get(wait_option);
+            if (ret != TX_SUCCESS) return ret;
+
+            // The semaphore count reserves one message for us. Another receiver may still take the message on
+            // the level we picked first, then the next level is tried.
+            for (;;) {
+                const auto index = mostUrgentLevel();
+                if (index >= Levels) {
+                    tx_thread_relinquish();
+                    continue;
+                }
+
+                auto &queue = levels[index];
+                const auto receiveRet = queue.receive(message, TX_NO_WAIT);
+
+                const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+                if (queue.getEnqueued() == 0) {
+                    nonEmptyLevels = nonEmptyLevels & ~(1UL << index);
+                }
+                tx_interrupt_control(posture);
+
+                if (receiveRet == TX_SUCCESS) {
+                    if (level != nullptr) *level = index;
+                    return TX_SUCCESS;
+                }
+            }
+        }
+
+        /**
+         * @brief Returns the number of messages waiting on a level, without a kernel call.
+         */
+        [[nodiscard]] ULONG getEnqueued(UINT level) const {
+            return level < Levels ? levels[level].getEnqueued() : 0;
+        }
+
+    private:
+        /** Returns the most urgent non-empty level, or Levels if there is none. */
+        UINT mostUrgentLevel() const {
+            const auto bitmap = nonEmptyLevels;
+            if (bitmap != 0) {
+                return static_cast<UINT>(__builtin_ctzl(bitmap));
+            }
+            // A sender may not have published its level bit yet
+            for (UINT index = 0; index < Levels; ++index) {
+                if (levels[index].getEnqueued() > 0) return index;
+            }
+            return Levels;
+        }
+
+        StaticQueue<T, DepthPerLevel> levels[Levels];
+        Semaphore available;
+        volatile ULONG nonEmptyLevels{};
+    };
+}
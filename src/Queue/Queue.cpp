@@ -4,9 +4,50 @@
  */
 
 #include "Queue.hpp"
+#include <algorithm>
+#include "tx_thread.h"
 
 using namespace Stm32ThreadX;
 
+namespace {
+    /**
+     * Raises the preemption threshold of the calling thread to 0 for its lifetime, so no other thread can
+     * preempt it. Does nothing in ISR context, where `tx_thread_identify()` is the interrupted thread.
+     */
+    class PreemptionLock {
+    public:
+        PreemptionLock()
+            : thread(TX_THREAD_GET_SYSTEM_STATE() == 0 ? tx_thread_identify() : nullptr) {
+            acquire();
+        }
+
+        ~PreemptionLock() {
+            release();
+        }
+
+        /** Lets other threads preempt again, e.g. before a call that may block. */
+        void release() {
+            if (thread != nullptr && locked) {
+                UINT ignored;
+                tx_thread_preemption_change(thread, oldThreshold, &ignored);
+                locked = false;
+            }
+        }
+
+        void acquire() {
+            if (thread != nullptr && !locked) {
+                // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_thread_preemption_change
+                locked = tx_thread_preemption_change(thread, 0, &oldThreshold) == TX_SUCCESS;
+            }
+        }
+
+    private:
+        TX_THREAD *thread;
+        UINT oldThreshold{};
+        bool locked{};
+    };
+}
+
 UINT Queue::create(UINT message_size) {
     return create(getNameNonConst(), message_size, queueMem, queueMemSize);
 }
@@ -16,3 +57,46 @@ bool Queue::isEmpty() {
     info_get(nullptr, &enqueued, nullptr, nullptr, nullptr, nullptr);
     return enqueued == 0;
 }
+
+UINT Queue::receiveBatch(VOID *destination_ptr, ULONG count, ULONG min_count, ULONG wait_option, ULONG &received) {
+    received = 0;
+    if (count == 0) return TX_SUCCESS;
+
+    const auto messageBytes = tx_queue_message_size * sizeof(ULONG);
+    auto *destination = static_cast<UCHAR *>(destination_ptr);
+    min_count = std::min(std::max(min_count, static_cast<ULONG>(1)), count);
+
+    for (; received < min_count; ++received) {
+        const auto ret = receive(destination + received * messageBytes, wait_option);
+        if (ret != TX_SUCCESS) return ret;
+    }
+
+    PreemptionLock lock;
+    while (received < count
+           && tx_queue_receive(this, destination + received * messageBytes, TX_NO_WAIT) == TX_SUCCESS) {
+        ++received;
+    }
+    return TX_SUCCESS;
+}
+
+UINT Queue::sendBatch(VOID *source_ptr, ULONG count, ULONG wait_option, ULONG &sent) {
+    sent = 0;
+
+    const auto messageBytes = tx_queue_message_size * sizeof(ULONG);
+    auto *source = static_cast<UCHAR *>(source_ptr);
+
+    PreemptionLock lock;
+    for (; sent < count; ++sent) {
+        auto *message = source + sent * messageBytes;
+        // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_queue_send
+        auto ret = tx_queue_send(this, message, TX_NO_WAIT);
+        if (ret == TX_QUEUE_FULL && wait_option != TX_NO_WAIT) {
+            // Never suspend with preemption held off, the receivers must be able to make room
+            lock.release();
+            ret = tx_queue_send(this, message, wait_option);
+            lock.acquire();
+        }
+        if (ret != TX_SUCCESS) return ret;
+    }
+    return TX_SUCCESS;
+}
@@ -5,7 +5,11 @@
 
 #pragma once
 
+#include <type_traits>
 #include "BaseQueue.hpp"
+#if __cplusplus >= 202002L
+#include <span>
+#endif
 
 namespace Stm32ThreadX {
     class Queue : public BaseQueue {
@@ -40,6 +44,81 @@ namespace Stm32ThreadX {
          */
         virtual bool isEmpty();
 
+        /**
+         * @brief Receives up to `count` messages with a single wakeup.
+         *
+         * Blocks according to `wait_option` until `min_count` messages have been received, then drains whatever
+         * else is already enqueued without blocking. The drain runs with preemption held off, so senders that are
+         * woken up by the freed space do not preempt the caller once per message.
+         *
+         * @param destination_ptr Pointer to memory for `count` messages of the queue's message size.
+         * @param count The maximum number of messages to receive.
+         * @param min_count The number of messages to wait for. Values below 1 are treated as 1.
+         * @param wait_option Amount of time, in ticks, to wait for each of the first `min_count` messages.
+         * @param received Set to the number of messages actually received.
+         *
+         * @return TX_SUCCESS if at least `min_count` messages were received, otherwise the status code of
+         * the receive that failed.
+         */
+        UINT receiveBatch(VOID *destination_ptr, ULONG count, ULONG min_count, ULONG wait_option, ULONG &received);
+
+        /**
+         * @brief Sends `count` messages with preemption held off once for the whole batch.
+         *
+         * Receivers that are woken up by the new messages run after the batch has been enqueued instead of
+         * after each message. If the queue fills up and `wait_option` allows waiting, preemption is allowed
+         * again while the caller waits for space. In ISR context only TX_NO_WAIT is valid and preemption is
+         * not touched.
+         *
+         * @param source_ptr Pointer to `count` messages of the queue's message size.
+         * @param count The number of messages to send.
+         * @param wait_option Amount of time, in ticks, to wait for space for each message.
+         * @param sent Set to the number of messages actually sent.
+         *
+         * @return TX_SUCCESS if all messages were sent, otherwise the status code of the send that failed.
+         */
+        UINT sendBatch(VOID *source_ptr, ULONG count, ULONG wait_option, ULONG &sent);
+
+        /**
+         * @brief Typed variant of `receiveBatch()`.
+         *
+         * @return TX_SIZE_ERROR if `sizeof(T)` does not match the message size of the queue, otherwise
+         * see `receiveBatch()`.
+         */
+        template<typename T>
+        UINT receiveBatch(T *messages, ULONG count, ULONG min_count, ULONG wait_option, ULONG &received) {
+            static_assert(std::is_trivially_copyable<T>::value, "Queue: T must be trivially copyable");
+            received = 0;
+            if (sizeof(T) != tx_queue_message_size * sizeof(ULONG)) return TX_SIZE_ERROR;
+            return receiveBatch(static_cast<VOID *>(messages), count, min_count, wait_option, received);
+        }
+
+        /**
+         * @brief Typed variant of `sendBatch()`.
+         *
+         * @return TX_SIZE_ERROR if `sizeof(T)` does not match the message size of the queue, otherwise
+         * see `sendBatch()`.
+         */
+        template<typename T>
+        UINT sendBatch(const T *messages, ULONG count, ULONG wait_option, ULONG &sent) {
+            static_assert(std::is_trivially_copyable<T>::value, "Queue: T must be trivially copyable");
+            sent = 0;
+            if (sizeof(T) != tx_queue_message_size * sizeof(ULONG)) return TX_SIZE_ERROR;
+            return sendBatch(const_cast<T *>(messages), count, wait_option, sent);
+        }
+
+#if __cpp_lib_span >= 202002L
+        template<typename T, std::size_t Extent>
+        UINT receiveBatch(std::span<T, Extent> messages, ULONG min_count, ULONG wait_option, ULONG &received) {
+            return receiveBatch(messages.data(), messages.size(), min_count, wait_option, received);
+        }
+
+        template<typename T, std::size_t Extent>
+        UINT sendBatch(std::span<T, Extent> messages, ULONG wait_option, ULONG &sent) {
+            return sendBatch(messages.data(), messages.size(), wait_option, sent);
+        }
+#endif
+
         using BaseQueue::create;
 
     private:
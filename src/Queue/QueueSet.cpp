@@ -0,0 +1,172 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "QueueSet.hpp"
+#include "LogLevel.hpp"
+
+using namespace Stm32ThreadX;
+
+QueueSet::member_t QueueSet::members[LIBSMART_STM32THREADX_QUEUESET_MAX_MEMBERS]{};
+
+UINT QueueSet::create() {
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::QueueSet[%s]::create()\r\n", getName());
+
+    return flags.create();
+}
+
+UINT QueueSet::del() {
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::QueueSet[%s]::del()\r\n", getName());
+
+    remove(usedMask);
+    return flags.deleteFlags();
+}
+
+UINT QueueSet::add(BaseQueue &queue, ULONG &member_mask) {
+    auto ret = add(&queue, memberType_t::QUEUE, 0, member_mask);
+    if (ret != TX_SUCCESS) return ret;
+
+    ret = queue.send_notify(&QueueSet::queueNotify);
+    if (ret != TX_SUCCESS) remove(member_mask);
+    return ret;
+}
+
+UINT QueueSet::add(BaseSemaphore &semaphore, ULONG &member_mask) {
+    auto ret = add(&semaphore, memberType_t::SEMAPHORE, 0, member_mask);
+    if (ret != TX_SUCCESS) return ret;
+
+    ret = semaphore.put_notify(&QueueSet::semaphoreNotify);
+    if (ret != TX_SUCCESS) remove(member_mask);
+    return ret;
+}
+
+UINT QueueSet::add(BaseEventFlags &eventFlags, ULONG requested_flags, ULONG &member_mask) {
+    auto ret = add(&eventFlags, memberType_t::EVENT_FLAGS, requested_flags, member_mask);
+    if (ret != TX_SUCCESS) return ret;
+
+    ret = eventFlags.set_notify(&QueueSet::eventFlagsNotify);
+    if (ret != TX_SUCCESS) remove(member_mask);
+    return ret;
+}
+
+UINT QueueSet::add(void *object, memberType_t type, ULONG requested_flags, ULONG &member_mask) {
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::QueueSet[%s]::add(%p)\r\n", getName(), object);
+
+    member_mask = 0;
+    UINT ret = TX_NO_INSTANCE;
+
+    // The notify callbacks may run in ISR context and walk the registry
+    const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+    for (ULONG bit = 0; bit < sizeof(ULONG) * 8 && member_mask == 0; ++bit) {
+        if ((usedMask & (1UL << bit)) == 0) {
+            member_mask = 1UL << bit;
+        }
+    }
+    if (member_mask != 0) {
+        for (auto &member: members) {
+            if (member.set == nullptr) {
+                member = {this, object, type, member_mask, requested_flags};
+                usedMask |= member_mask;
+                ret = TX_SUCCESS;
+                break;
+            }
+        }
+    }
+    tx_interrupt_control(posture);
+
+    if (ret != TX_SUCCESS) {
+        member_mask = 0;
+        LIBSMART_LOG(ERROR, "Stm32ThreadX::QueueSet[%s]: no free member slot\r\n", getName());
+    }
+    return ret;
+}
+
+void QueueSet::remove(ULONG member_mask) {
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::QueueSet[%s]::remove(0x%08x)\r\n", getName(), member_mask);
+
+    for (auto &member: members) {
+        if (member.set != this || (member.mask & member_mask) == 0) continue;
+
+        switch (member.type) {
+            case memberType_t::QUEUE:
+                static_cast<BaseQueue *>(member.object)->send_notify(nullptr);
+                break;
+            case memberType_t::SEMAPHORE:
+                static_cast<BaseSemaphore *>(member.object)->put_notify(nullptr);
+                break;
+            case memberType_t::EVENT_FLAGS:
+                static_cast<BaseEventFlags *>(member.object)->set_notify(nullptr);
+                break;
+        }
+
+        const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+        usedMask &= ~member.mask;
+        member = {};
+        tx_interrupt_control(posture);
+    }
+}
+
+ULONG QueueSet::ready() const {
+    ULONG mask = 0;
+    for (const auto &member: members) {
+        if (member.set == this && isReady(member)) {
+            mask |= member.mask;
+        }
+    }
+    return mask;
+}
+
+ULONG QueueSet::wait(ULONG wait_option) {
+    const auto start = tx_time_get();
+    for (;;) {
+        // Clear before checking, so a notification between the check and the wait is not lost
+        flags.clear(usedMask);
+        if (const auto mask = ready()) return mask;
+
+        auto remaining = wait_option;
+        if (wait_option != TX_WAIT_FOREVER) {
+            const ULONG elapsed = tx_time_get() - start;
+            if (elapsed >= wait_option) return 0;
+            remaining = wait_option - elapsed;
+        }
+
+        if (flags.await(usedMask, EventFlags::getOption_t::OR, EventFlags::waitOption_t{remaining}) != TX_SUCCESS) {
+            return ready();
+        }
+    }
+}
+
+bool QueueSet::isReady(const member_t &member) {
+    switch (member.type) {
+        case memberType_t::QUEUE:
+            return static_cast<const BaseQueue *>(member.object)->tx_queue_enqueued > 0;
+        case memberType_t::SEMAPHORE:
+            return static_cast<const BaseSemaphore *>(member.object)->tx_semaphore_count > 0;
+        case memberType_t::EVENT_FLAGS:
+            return (static_cast<const BaseEventFlags *>(member.object)->tx_event_flags_group_current
+                    & member.requestedFlags) != 0;
+    }
+    return false;
+}
+
+void QueueSet::notify(const void *object) {
+    for (const auto &member: members) {
+        if (member.object == object && member.set != nullptr) {
+            member.set->flags.set(member.mask);
+            return;
+        }
+    }
+}
+
+void QueueSet::queueNotify(TX_QUEUE *queue_ptr) {
+    notify(BaseQueue::fromNative(queue_ptr));
+}
+
+void QueueSet::semaphoreNotify(TX_SEMAPHORE *semaphore_ptr) {
+    notify(BaseSemaphore::fromNative(semaphore_ptr));
+}
+
+void QueueSet::eventFlagsNotify(TX_EVENT_FLAGS_GROUP *group_ptr) {
+    notify(BaseEventFlags::fromNative(group_ptr));
+}
@@ -0,0 +1,147 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <libsmart_config.hpp>
+#include "Loggable.hpp"
+#include "Nameable.hpp"
+#include "tx_api.h"
+#include "BaseQueue.hpp"
+#include "EventFlags/EventFlags.hpp"
+#include "Semaphore/BaseSemaphore.hpp"
+
+namespace Stm32ThreadX {
+    /**
+     * @class QueueSet
+     * @brief Blocks on several queues, semaphores and event flags groups at once.
+     *
+     * Each member gets one bit of the set's internal event flags group. The member's notify hook
+     * (`send_notify()`, `put_notify()` or `set_notify()`) sets that bit, so `wait()` sleeps in a single
+     * `tx_event_flags_get()` until any member may have become ready. `wait()` then reads the members' control
+     * blocks and returns a mask of the members that are ready right now. The caller still has to receive or get
+     * from the ready members itself.
+     *
+     * Registering a member takes over its notify hook. A member can be registered with only one set.
+     * At most `LIBSMART_STM32THREADX_QUEUESET_MAX_MEMBERS` members can be registered over all sets.
+     */
+    class QueueSet : public Stm32ItmLogger::Loggable, public Stm32Common::Nameable {
+    public:
+        QueueSet() : QueueSet(&Stm32ItmLogger::emptyLogger) { ; }
+
+        explicit QueueSet(const char *name)
+            : QueueSet(name, &Stm32ItmLogger::emptyLogger) { ; }
+
+        explicit QueueSet(Stm32ItmLogger::LoggerInterface *logger)
+            : QueueSet("Stm32ThreadX::QueueSet", logger) { ; }
+
+        QueueSet(const char *name, Stm32ItmLogger::LoggerInterface *logger)
+            : Loggable(logger), Nameable(name), flags(name, logger) { ; }
+
+        /**
+         * @brief Creates the internal event flags group.
+         *
+         * @return The status code of `tx_event_flags_create()`.
+         */
+        UINT create();
+
+        /**
+         * @brief Removes all members and deletes the internal event flags group.
+         *
+         * @return The status code of `tx_event_flags_delete()`.
+         */
+        UINT del();
+
+        /**
+         * @brief Adds a queue. It is ready while it holds at least one message.
+         *
+         * @param queue The queue to add.
+         * @param member_mask Receives the bit that represents the queue in the masks returned by `wait()`.
+         *
+         * @return TX_SUCCESS, TX_NO_INSTANCE if the set or the registry is full, or the status code of
+         * `send_notify()`.
+         */
+        UINT add(BaseQueue &queue, ULONG &member_mask);
+
+        /**
+         * @brief Adds a semaphore. It is ready while its count is greater than zero.
+         *
+         * @param semaphore The semaphore to add.
+         * @param member_mask Receives the bit that represents the semaphore in the masks returned by `wait()`.
+         *
+         * @return TX_SUCCESS, TX_NO_INSTANCE if the set or the registry is full, or the status code of
+         * `put_notify()`.
+         */
+        UINT add(BaseSemaphore &semaphore, ULONG &member_mask);
+
+        /**
+         * @brief Adds an event flags group. It is ready while any of `requested_flags` is set.
+         *
+         * @param eventFlags The event flags group to add.
+         * @param requested_flags The flags that make the group ready.
+         * @param member_mask Receives the bit that represents the group in the masks returned by `wait()`.
+         *
+         * @return TX_SUCCESS, TX_NO_INSTANCE if the set or the registry is full, or the status code of
+         * `set_notify()`.
+         */
+        UINT add(BaseEventFlags &eventFlags, ULONG requested_flags, ULONG &member_mask);
+
+        /**
+         * @brief Removes members and restores their notify hooks to none.
+         *
+         * @param member_mask The bits of the members to remove.
+         */
+        void remove(ULONG member_mask);
+
+        /**
+         * @brief Returns the members that are ready right now, without blocking and without a kernel call.
+         *
+         * @return A mask of member bits.
+         */
+        ULONG ready() const;
+
+        /**
+         * @brief Waits until at least one member is ready.
+         *
+         * @param wait_option Amount of time, in ticks, to wait in total. TX_NO_WAIT or TX_WAIT_FOREVER can also
+         * be used.
+         *
+         * @return A mask of the ready members, or 0 if none became ready within `wait_option`.
+         */
+        ULONG wait(ULONG wait_option);
+
+    private:
+        enum class memberType_t : UCHAR {
+            QUEUE,
+            SEMAPHORE,
+            EVENT_FLAGS
+        };
+
+        struct member_t {
+            QueueSet *set;
+            void *object;
+            memberType_t type;
+            ULONG mask;
+            ULONG requestedFlags;
+        };
+
+        UINT add(void *object, memberType_t type, ULONG requested_flags, ULONG &member_mask);
+
+        static bool isReady(const member_t &member);
+
+        static void notify(const void *object);
+
+        static void queueNotify(TX_QUEUE *queue_ptr);
+
+        static void semaphoreNotify(TX_SEMAPHORE *semaphore_ptr);
+
+        static void eventFlagsNotify(TX_EVENT_FLAGS_GROUP *group_ptr);
+
+        static member_t members[LIBSMART_STM32THREADX_QUEUESET_MAX_MEMBERS];
+
+        EventFlags flags;
+        ULONG usedMask{};
+    };
+}
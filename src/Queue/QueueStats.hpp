@@ -0,0 +1,55 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include "tx_api.h"
+
+namespace Stm32ThreadX {
+    /**
+     * @struct QueueStats
+     * @brief Snapshot of the depth and latency statistics of an `InstrumentedQueue`.
+     *
+     * Latencies are counted in log2 histograms of timer ticks: bucket 0 counts 0 ticks, bucket `k` counts
+     * `[2^(k-1), 2^k)` ticks, and the last bucket also counts everything above.
+     */
+    struct QueueStats {
+        static constexpr std::size_t HISTOGRAM_BUCKETS = 16;
+
+        using histogram_t = std::array<ULONG, HISTOGRAM_BUCKETS>;
+
+        /** Number of messages in the queue when the snapshot was taken. */
+        ULONG depth{};
+        /** Highest number of messages that were in the queue at the same time. */
+        ULONG highWaterMark{};
+        /** Number of messages sent successfully. */
+        ULONG sent{};
+        /** Number of messages received successfully. */
+        ULONG received{};
+        /** Ticks each message spent in the queue, from send to receive. */
+        histogram_t residencyTicks{};
+        /** Ticks senders spent in send calls, including calls that had to wait for space. */
+        histogram_t senderBlockTicks{};
+        /** Ticks receivers spent in receive calls, including calls that had to wait for a message. */
+        histogram_t receiverBlockTicks{};
+
+        /**
+         * @brief Returns the histogram bucket for a number of ticks.
+         *
+         * @param ticks The number of ticks.
+         * @return The bucket index.
+         */
+        static constexpr std::size_t bucketOf(ULONG ticks) {
+            std::size_t bucket = 0;
+            while (ticks != 0 && bucket < HISTOGRAM_BUCKETS - 1) {
+                ticks >>= 1;
+                ++bucket;
+            }
+            return bucket;
+        }
+    };
+}
@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <cstddef>
+#include "StaticQueue.hpp"
+#include "Stm32ThreadX.hpp"
+#include "Thread.hpp"
+
+namespace Stm32ThreadX {
+    /**
+     * @class ShardedQueue
+     * @brief A multi-consumer queue that keeps messages with the same key in order.
+     *
+     * Producers pick a shard with a key function, e.g. the device address. Every shard is a `StaticQueue` with
+     * its own consumer thread, so messages with the same key are processed in the order they were sent, while
+     * different keys are processed in parallel. `getEnqueued()` reports the depth of each shard, which makes
+     * an imbalanced key distribution visible.
+     *
+     * @tparam T The message type, see `StaticQueue`.
+     * @tparam Shards The number of shards and consumer threads.
+     * @tparam DepthPerShard The number of messages each shard can hold.
+     * @tparam StackSize The stack size of each consumer thread in bytes.
+     */
+    template<typename T, std::size_t Shards, std::size_t DepthPerShard, std::size_t StackSize>
+    class ShardedQueue {
+        static_assert(Shards > 0, "ShardedQueue: Shards must be greater than 0");
+
+    public:
+        using value_type = T;
+
+        /** Returns the key of a message. Messages with equal keys go to the same shard. */
+        using key_fn = ULONG (*)(const T &message);
+
+        /** Processes one message in the consumer thread of its shard. */
+        using handler_fn = void (*)(std::size_t shard, T &message, void *context);
+
+        static constexpr std::size_t SHARDS = Shards;
+
+        ShardedQueue(key_fn key, handler_fn handler, void *context = nullptr,
+                     const char *name = "Stm32ThreadX::ShardedQueue")
+            : key(key), handler(handler), context(context) {
+            for (std::size_t i = 0; i < Shards; ++i) {
+                shards[i].owner = this;
+                shards[i].index = i;
+                shards[i].queue.setName(name);
+            }
+        }
+
+        /**
+         * @brief Creates the shard queues and starts one consumer thread per shard.
+         *
+         * @param prio The priority of the consumer threads.
+         *
+         * @return TX_SUCCESS, or the status code of the first queue or thread creation that failed.
+         */
+        UINT create(Thread::priority prio) {
+            for (auto &shard: shards) {
+                const auto ret = shard.queue.create();
+                if (ret != TX_SUCCESS) return ret;
+            }
+            for (auto &shard: shards) {
+                const auto ret = shard.thread.createThread(shard.queue.getName());
+                if (ret != TX_SUCCESS) return ret;
+                shard.thread.setPriority(prio);
+                shard.thread.resume();
+            }
+            return TX_SUCCESS;
+        }
+
+        /**
+         * @brief Sends a message to the shard selected by its key.
+         *
+         * @param message The message to send.
+         * @param wait_option Amount of time, in ticks, to suspend if the shard is full.
+         *
+         * @return The status code of the shard's `tx_queue_send()`.
+         */
+        UINT send(const T &message, ULONG wait_option) {
+            return shards[shardOf(message)].queue.send(message, wait_option);
+        }
+
+        /**
+         * @brief Returns the shard a message is sent to.
+         */
+        [[nodiscard]] std::size_t shardOf(const T &message) const {
+            return key(message) % Shards;
+        }
+
+        /**
+         * @brief Returns the number of messages waiting in a shard, without a kernel call.
+         */
+        [[nodiscard]] ULONG getEnqueued(std::size_t shard) const {
+            return shard < Shards ? shards[shard].queue.getEnqueued() : 0;
+        }
+
+    private:
+        struct Shard {
+            Shard()
+                : thread(BOUNCE(Shard, run), reinterpret_cast<ULONG>(this)) { ; }
+
+            /** Ends the consumer thread once a receive fails, e.g. on a deleted queue, instead of spinning. */
+            void run() {
+                for (;;) {
+                    // No default construction, T only has to be trivially copyable
+                    union Storage {
+                        Storage() { ; }
+
+                        T message;
+                    } storage;
+                    if (queue.receive(storage.message, TX_WAIT_FOREVER) != TX_SUCCESS) return;
+                    owner->handler(index, storage.message, owner->context);
+                }
+            }
+
+            ShardedQueue *owner{};
+            std::size_t index{};
+            StaticQueue<T, DepthPerShard> queue;
+            StaticThread<StackSize> thread;
+        };
+
+        key_fn key;
+        handler_fn handler;
+        void *context;
+        Shard shards[Shards];
+    };
+}
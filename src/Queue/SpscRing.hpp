@@ -0,0 +1,156 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include "tx_api.h"
+#include "EventFlags/EventFlags.hpp"
+#include "Semaphore/BaseSemaphore.hpp"
+
+namespace Stm32ThreadX {
+    /**
+     * @class SpscRing
+     * @brief Lock-free single-producer/single-consumer ring buffer with a kernel wakeup only when needed.
+     *
+     * Meant for ISR-to-thread streams such as UART bytes or ADC samples. `push()` and `tryPop()` only touch two
+     * atomic indices. The producer signals the attached `Semaphore` or `EventFlags` bit only when the consumer has
+     * found the ring empty and is about to block in `pop()`. While the consumer keeps up, no kernel service is
+     * called at all.
+     *
+     * Exactly one context may push and exactly one thread may pop. Only atomic loads and stores are used, so
+     * cores without exclusive access instructions (Cortex-M0) are supported as well.
+     *
+     * @tparam T The element type. Must be trivially copyable.
+     * @tparam N The capacity. Must be a power of two.
+     */
+    template<typename T, std::size_t N>
+    class SpscRing {
+        static_assert(std::is_trivially_copyable<T>::value, "SpscRing: T must be trivially copyable");
+        static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRing: N must be a power of two");
+
+    public:
+        /**
+         * @brief Creates a ring that wakes the consumer through a semaphore.
+         *
+         * @param semaphore A created semaphore with an initial count of 0, used for nothing else.
+         */
+        explicit SpscRing(BaseSemaphore &semaphore)
+            : semaphore(&semaphore) { ; }
+
+        /**
+         * @brief Creates a ring that wakes the consumer through an event flag.
+         *
+         * @param eventFlags A created event flags group.
+         * @param flag The flag bit reserved for this ring.
+         */
+        SpscRing(EventFlags &eventFlags, ULONG flag)
+            : eventFlags(&eventFlags), flag(flag) { ; }
+
+        static constexpr std::size_t capacity() { return N; }
+
+        /**
+         * @brief Appends an element. Producer side, thread and ISR context callable.
+         *
+         * @param value The element to append.
+         * @return False if the ring is full, true otherwise.
+         */
+        bool push(const T &value) {
+            const auto h = head.load(std::memory_order_relaxed);
+            if (h - tail.load(std::memory_order_acquire) == N) return false;
+
+            buffer[h & (N - 1)] = value;
+            head.store(h + 1, std::memory_order_release);
+
+            // Pairs with the fence in pop(): either the consumer sees the new head, or we see its waiting flag.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiting.load(std::memory_order_relaxed)) {
+                waiting.store(false, std::memory_order_relaxed);
+                signal();
+            }
+            return true;
+        }
+
+        /**
+         * @brief Removes the oldest element without blocking. Consumer side.
+         *
+         * @param value Receives the element.
+         * @return False if the ring is empty, true otherwise.
+         */
+        bool tryPop(T &value) {
+            const auto t = tail.load(std::memory_order_relaxed);
+            if (head.load(std::memory_order_acquire) == t) return false;
+
+            value = buffer[t & (N - 1)];
+            tail.store(t + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Removes the oldest element, blocking until one is available. Consumer side, thread context only.
+         *
+         * @param value Receives the element.
+         * @param wait_option Amount of time, in ticks, to suspend while the ring is empty. TX_NO_WAIT or
+         * TX_WAIT_FOREVER can also be used.
+         *
+         * @return TX_SUCCESS if an element was removed, otherwise the status code of the failed wait.
+         */
+        UINT pop(T &value, ULONG wait_option) {
+            for (;;) {
+                if (tryPop(value)) return TX_SUCCESS;
+                if (wait_option == TX_NO_WAIT) return TX_QUEUE_EMPTY;
+
+                waiting.store(true, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (!empty()) {
+                    waiting.store(false, std::memory_order_relaxed);
+                    continue;
+                }
+
+                const auto ret = awaitSignal(wait_option);
+                waiting.store(false, std::memory_order_relaxed);
+                if (ret != TX_SUCCESS) {
+                    return tryPop(value) ? TX_SUCCESS : ret;
+                }
+                // A stale signal from an earlier race only causes another round through the loop.
+            }
+        }
+
+        /** Number of elements currently in the ring. */
+        [[nodiscard]] std::size_t size() const {
+            return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]] bool empty() const { return size() == 0; }
+
+    private:
+        void signal() {
+            if (semaphore != nullptr) {
+                semaphore->put();
+            } else {
+                eventFlags->set(flag);
+            }
+        }
+
+        UINT awaitSignal(ULONG wait_option) {
+            if (semaphore != nullptr) {
+                return semaphore->get(wait_option);
+            }
+            return eventFlags->await(flag, EventFlags::getOption_t::OR_CLEAR,
+                                     EventFlags::waitOption_t{wait_option});
+        }
+
+        BaseSemaphore *semaphore{};
+        EventFlags *eventFlags{};
+        ULONG flag{};
+
+        std::atomic<std::size_t> head{0};
+        std::atomic<std::size_t> tail{0};
+        std::atomic<bool> waiting{false};
+        T buffer[N]{};
+    };
+}
@@ -0,0 +1,149 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include "BaseQueue.hpp"
+
+namespace Stm32ThreadX {
+    /**
+     * @class StaticQueue
+     * @brief A typed message queue that owns its storage.
+     *
+     * The message size in ULONG words and the size of the queue memory are derived from `T` and `Depth` at compile
+     * time, so call sites no longer have to compute word counts or cast to `VOID *`. The typed `send()`,
+     * `front_send()` and `receive()` methods are inline and call `tx_queue_send()`, `tx_queue_front_send()` and
+     * `tx_queue_receive()` directly, without going through the virtual, logging methods of `BaseQueue`.
+     *
+     * @tparam T The message type. Must be trivially copyable and exactly 1, 2, 4, 8 or 16 ULONG words in size.
+     * @tparam Depth The number of messages the queue can hold.
+     *
+     * @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_queue_create
+     */
+    template<typename T, std::size_t Depth>
+    class StaticQueue : public BaseQueue {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "StaticQueue: T must be trivially copyable, ThreadX copies messages word by word");
+        static_assert(sizeof(T) % sizeof(ULONG) == 0,
+                      "StaticQueue: sizeof(T) must be a multiple of sizeof(ULONG)");
+        static_assert(sizeof(T) / sizeof(ULONG) == 1 || sizeof(T) / sizeof(ULONG) == 2 ||
+                      sizeof(T) / sizeof(ULONG) == 4 || sizeof(T) / sizeof(ULONG) == 8 ||
+                      sizeof(T) / sizeof(ULONG) == 16,
+                      "StaticQueue: sizeof(T) must be 1, 2, 4, 8 or 16 ULONG words");
+        static_assert(Depth > 0, "StaticQueue: Depth must be greater than 0");
+
+    public:
+        using value_type = T;
+
+        /** Size of one message in ULONG words, as passed to `tx_queue_create()`. */
+        static constexpr UINT MESSAGE_SIZE = sizeof(T) / sizeof(ULONG);
+
+        /** Number of messages the queue can hold. */
+        static constexpr std::size_t DEPTH = Depth;
+
+        StaticQueue() = default;
+
+        explicit StaticQueue(const char *name)
+            : BaseQueue(name) { ; }
+
+        explicit StaticQueue(Stm32ItmLogger::LoggerInterface *logger)
+            : BaseQueue(logger) { ; }
+
+        StaticQueue(const char *name, Stm32ItmLogger::LoggerInterface *logger)
+            : BaseQueue(name, logger) { ; }
+
+        /**
+         * @brief Creates the queue in the owned storage.
+         *
+         * @return Returns a UINT status code. TX_SUCCESS is returned if the queue is successfully created;
+         * otherwise, an error code is returned. If exceptions are enabled and the operation fails, a
+         * `std::runtime_error` is thrown.
+         */
+        UINT create() {
+            return BaseQueue::create(getNameNonConst(), MESSAGE_SIZE, queueMem, sizeof(queueMem));
+        }
+
+        /**
+         * @brief Sends a message to the back of the queue.
+         *
+         * @param message The message to copy into the queue.
+         * @param wait_option Amount of time, in ticks, to suspend if the queue is full. TX_NO_WAIT or
+         * TX_WAIT_FOREVER can also be used.
+         *
+         * @return The status code of `tx_queue_send()`. Errors are neither logged nor thrown.
+         */
+        UINT send(const T &message, ULONG wait_option) {
+            return withAlignedSource(message, [this, wait_option](VOID *source) {
+                return tx_queue_send(this, source, wait_option);
+            });
+        }
+
+        /**
+         * @brief Sends a message to the front of the queue.
+         *
+         * @param message The message to copy into the queue.
+         * @param wait_option Amount of time, in ticks, to suspend if the queue is full. TX_NO_WAIT or
+         * TX_WAIT_FOREVER can also be used.
+         *
+         * @return The status code of `tx_queue_front_send()`. Errors are neither logged nor thrown.
+         */
+        UINT front_send(const T &message, ULONG wait_option) {
+            return withAlignedSource(message, [this, wait_option](VOID *source) {
+                return tx_queue_front_send(this, source, wait_option);
+            });
+        }
+
+        /**
+         * @brief Receives a message from the queue.
+         *
+         * @param message The message the received data is copied into. It is left untouched if no message
+         * was received.
+         * @param wait_option Amount of time, in ticks, to suspend if the queue is empty. TX_NO_WAIT or
+         * TX_WAIT_FOREVER can also be used.
+         *
+         * @return The status code of `tx_queue_receive()`. Errors are neither logged nor thrown.
+         */
+        UINT receive(T &message, ULONG wait_option) {
+            if constexpr (alignof(T) >= alignof(ULONG)) {
+                return tx_queue_receive(this, &message, wait_option);
+            } else {
+                ULONG buffer[MESSAGE_SIZE];
+                const auto ret = tx_queue_receive(this, buffer, wait_option);
+                if (ret == TX_SUCCESS) {
+                    std::memcpy(&message, buffer, sizeof(T));
+                }
+                return ret;
+            }
+        }
+
+        /**
+         * @brief Returns the number of messages currently in the queue, without a kernel call.
+         */
+        [[nodiscard]] ULONG getEnqueued() const {
+            return tx_queue_enqueued;
+        }
+
+    private:
+        /**
+         * ThreadX copies messages with ULONG accesses, so types with a weaker alignment are staged in an
+         * aligned buffer first. For all other types this is a plain pointer cast.
+         */
+        template<typename Fn>
+        static UINT withAlignedSource(const T &message, Fn fn) {
+            if constexpr (alignof(T) >= alignof(ULONG)) {
+                return fn(const_cast<T *>(&message));
+            } else {
+                ULONG buffer[MESSAGE_SIZE];
+                std::memcpy(buffer, &message, sizeof(T));
+                return fn(buffer);
+            }
+        }
+
+        ULONG queueMem[MESSAGE_SIZE * Depth]{};
+    };
+}
@@ -0,0 +1,221 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <utility>
+#include "StaticQueue.hpp"
+
+namespace Stm32ThreadX {
+    /**
+     * @class ZeroCopyQueue
+     * @brief A queue for large messages that passes pointers into an owned block pool instead of copying.
+     *
+     * The producer allocates a message slot from the queue's `TX_BLOCK_POOL`, fills it in place and sends it. Only
+     * the pointer travels through the underlying `StaticQueue`. The consumer receives a move-only `MessagePtr` that
+     * destroys the message and returns its block to the pool when it goes out of scope.
+     *
+     * Pool and queue both hold `Depth` entries, so a producer can never send more messages than the pool holds.
+     *
+     * @tparam T The message type. Its alignment must not exceed `ALIGN_TYPE`.
+     * @tparam Depth The number of messages that can be allocated and in flight at the same time.
+     *
+     * @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_block_pool_create
+     */
+    template<typename T, std::size_t Depth>
+    class ZeroCopyQueue {
+        static_assert(alignof(T) <= alignof(ALIGN_TYPE),
+                      "ZeroCopyQueue: alignment of T exceeds the alignment of ThreadX memory blocks");
+        static_assert(Depth > 0, "ZeroCopyQueue: Depth must be greater than 0");
+
+    public:
+        /**
+         * @class MessagePtr
+         * @brief Move-only owner of a message slot in the block pool.
+         *
+         * Destroying a non-empty `MessagePtr` destroys the message and returns its block to the pool.
+         */
+        class MessagePtr {
+        public:
+            MessagePtr() = default;
+
+            MessagePtr(const MessagePtr &) = delete;
+
+            MessagePtr &operator=(const MessagePtr &) = delete;
+
+            MessagePtr(MessagePtr &&other) noexcept
+                : ptr(std::exchange(other.ptr, nullptr)) { ; }
+
+            MessagePtr &operator=(MessagePtr &&other) noexcept {
+                if (this != &other) {
+                    reset();
+                    ptr = std::exchange(other.ptr, nullptr);
+                }
+                return *this;
+            }
+
+            ~MessagePtr() { reset(); }
+
+            T *get() const { return ptr; }
+
+            T &operator*() const { return *ptr; }
+
+            T *operator->() const { return ptr; }
+
+            explicit operator bool() const { return ptr != nullptr; }
+
+            /**
+             * @brief Destroys the message and returns its block to the pool.
+             *
+             * @return The status code of `tx_block_release()`, or TX_SUCCESS if the pointer was empty.
+             */
+            UINT reset() {
+                if (ptr == nullptr) return TX_SUCCESS;
+                ptr->~T();
+                // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_block_release
+                return tx_block_release(std::exchange(ptr, nullptr));
+            }
+
+        private:
+            friend class ZeroCopyQueue;
+
+            explicit MessagePtr(T *ptr)
+                : ptr(ptr) { ; }
+
+            /** Gives up ownership without destroying the message. */
+            T *release() { return std::exchange(ptr, nullptr); }
+
+            T *ptr{};
+        };
+
+        /** Size of one block as passed to `tx_block_pool_create()`, rounded up the way ThreadX does. */
+        static constexpr ULONG BLOCK_SIZE = (sizeof(T) + sizeof(ALIGN_TYPE) - 1) / sizeof(ALIGN_TYPE) * sizeof(ALIGN_TYPE);
+
+        /** Size of the pool memory; ThreadX keeps one pointer of overhead in front of every block. */
+        static constexpr ULONG POOL_SIZE = Depth * (BLOCK_SIZE + sizeof(UCHAR *));
+
+        ZeroCopyQueue() = default;
+
+        explicit ZeroCopyQueue(const char *name)
+            : queue(name) { ; }
+
+        explicit ZeroCopyQueue(Stm32ItmLogger::LoggerInterface *logger)
+            : queue(logger) { ; }
+
+        ZeroCopyQueue(const char *name, Stm32ItmLogger::LoggerInterface *logger)
+            : queue(name, logger) { ; }
+
+        /**
+         * @brief Creates the block pool and the underlying pointer queue.
+         *
+         * @return Returns a UINT status code. TX_SUCCESS is returned if both the pool and the queue were created;
+         * otherwise, the error code of the failing call is returned.
+         */
+        UINT create() {
+            // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_block_pool_create
+            const auto ret = tx_block_pool_create(&blockPool, queue.getNameNonConst(), BLOCK_SIZE, poolMem, POOL_SIZE);
+            if (ret != TX_SUCCESS) return ret;
+            return queue.create();
+        }
+
+        /**
+         * @brief Deletes the underlying queue and the block pool.
+         *
+         * All `MessagePtr`s must have been destroyed before.
+         *
+         * @return The status code of the queue deletion, or of `tx_block_pool_delete()` if that one failed.
+         */
+        UINT del() {
+            const auto ret = queue.del();
+            // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_block_pool_delete
+            const auto poolRet = tx_block_pool_delete(&blockPool);
+            return ret != TX_SUCCESS ? ret : poolRet;
+        }
+
+        /**
+         * @brief Allocates and default-initializes a message slot from the pool.
+         *
+         * @param wait_option Amount of time, in ticks, to suspend if no block is available. TX_NO_WAIT or
+         * TX_WAIT_FOREVER can also be used.
+         * @param status Optional pointer that receives the status code of `tx_block_allocate()`.
+         *
+         * @return An owning pointer to the new message, or an empty pointer if no block could be allocated.
+         */
+        MessagePtr allocate(ULONG wait_option, UINT *status = nullptr) {
+            VOID *block = nullptr;
+            // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_block_allocate
+            const auto ret = tx_block_allocate(&blockPool, &block, wait_option);
+            if (status != nullptr) *status = ret;
+            if (ret != TX_SUCCESS) return MessagePtr();
+            return MessagePtr(new(block) T);
+        }
+
+        /**
+         * @brief Sends a message to the back of the queue without copying it.
+         *
+         * On success the queue takes over ownership and `message` is left empty. On failure `message` keeps
+         * ownership, so the slot is returned to the pool when it goes out of scope.
+         *
+         * @param message The message to send. Must have been allocated from this queue.
+         * @param wait_option Amount of time, in ticks, to suspend if the queue is full.
+         *
+         * @return The status code of `tx_queue_send()`.
+         */
+        UINT send(MessagePtr &message, ULONG wait_option) {
+            return transfer(message, queue.send(Envelope{message.get()}, wait_option));
+        }
+
+        /**
+         * @brief Sends a message to the front of the queue without copying it.
+         *
+         * Ownership is handled like in `send()`.
+         *
+         * @param message The message to send. Must have been allocated from this queue.
+         * @param wait_option Amount of time, in ticks, to suspend if the queue is full.
+         *
+         * @return The status code of `tx_queue_front_send()`.
+         */
+        UINT front_send(MessagePtr &message, ULONG wait_option) {
+            return transfer(message, queue.front_send(Envelope{message.get()}, wait_option));
+        }
+
+        /**
+         * @brief Receives a message from the queue.
+         *
+         * @param message Receives ownership of the message. Any message it held before is released first.
+         * @param wait_option Amount of time, in ticks, to suspend if the queue is empty.
+         *
+         * @return The status code of `tx_queue_receive()`.
+         */
+        UINT receive(MessagePtr &message, ULONG wait_option) {
+            message.reset();
+            Envelope envelope{};
+            const auto ret = queue.receive(envelope, wait_option);
+            if (ret == TX_SUCCESS) {
+                message = MessagePtr(envelope.ptr);
+            }
+            return ret;
+        }
+
+    private:
+        /** The message that actually travels through the queue. */
+        struct Envelope {
+            T *ptr;
+        };
+
+        static UINT transfer(MessagePtr &message, const UINT ret) {
+            if (ret == TX_SUCCESS) {
+                message.release();
+            }
+            return ret;
+        }
+
+        StaticQueue<Envelope, Depth> queue;
+        TX_BLOCK_POOL blockPool{};
+        ALIGN_TYPE poolMem[(POOL_SIZE + sizeof(ALIGN_TYPE) - 1) / sizeof(ALIGN_TYPE)]{};
+    };
+}
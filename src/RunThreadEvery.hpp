@@ -24,6 +24,7 @@
 #define LIBSMART_STM32THREADX_RUNTHREADEVERY_HPP
 
 #include <libsmart_config.hpp>
+#include <chrono>
 #include <cstdint>
 #include <functional>
 #include "Helper.hpp"
@@ -46,6 +47,13 @@ namespace Stm32ThreadX {
                      "Stm32ThreadX::RunThreadEvery"),
               RunEvery(interval_ms, delay_ms, run_count_max) { ; }
 
+        RunThreadEvery(uint32_t interval_ms, uint32_t delay_ms, uint32_t run_count_max,
+                       const ThreadAttributes &attr)
+            : Thread(BOUNCE(RunThreadEvery, loopThread),
+                     reinterpret_cast<ULONG>(this), attr,
+                     "Stm32ThreadX::RunThreadEvery"),
+              RunEvery(interval_ms, delay_ms, run_count_max) { ; }
+
 #ifdef LIBSMART_ENABLE_STD_FUNCTION
         explicit RunThreadEvery(const fn_t &fn)
             : RunThreadEvery(0, 0, 0, fn) { ; }
@@ -61,17 +69,88 @@ namespace Stm32ThreadX {
                      reinterpret_cast<ULONG>(this), Thread::priority(),
                      "Stm32ThreadX::RunThreadEvery"),
               RunEvery(interval_ms, delay_ms, run_count_max, fn) { ; }
+
+        RunThreadEvery(uint32_t interval_ms, uint32_t delay_ms, uint32_t run_count_max,
+                       const ThreadAttributes &attr, const fn_t &fn)
+            : Thread(BOUNCE(RunThreadEvery, loopThread),
+                     reinterpret_cast<ULONG>(this), attr,
+                     "Stm32ThreadX::RunThreadEvery"),
+              RunEvery(interval_ms, delay_ms, run_count_max, fn) { ; }
 #endif
 
+        /**
+         * @brief Changes the interval. The thread wakes up and computes its next due time at once.
+         */
+        void setInterval(uint32_t interval_ms) {
+            _interval_ms = interval_ms;
+            wake();
+        }
+
+        /**
+         * @brief Wakes the thread to check now whether the job is due, instead of at its next due time.
+         *
+         * This does not force a run. The job runs only if `RunEvery` considers it due by its own clock, e.g.
+         * after its timing was changed.
+         *
+         * Thread and ISR context callable.
+         */
+        void reevaluate() {
+            wake();
+        }
+
+        /**
+         * @brief Runs the job now instead of at its next due time. The interval restarts from this run.
+         *
+         * The thread moves the last run of `RunEvery` back by one interval, so the job is due at once. Before the
+         * first run the delay still applies, and once `run_count_max` is reached the job does not run anymore.
+         *
+         * Thread and ISR context callable.
+         */
+        void trigger() {
+            triggered = true;
+            wake();
+        }
+
     protected:
+        /**
+         * The thread sleeps until the job is due by the tick counter, instead of polling it every tick.
+         * `RunEvery` keeps its own millisecond clock, so if the job did not run when it was due by the tick counter,
+         * it is retried every tick until it runs. Once `run_count_max` is reached, the thread sleeps until woken.
+         */
         [[noreturn]] void loopThread() {
-            // tx_thread_sleep((_delay_ms * TX_TIMER_TICKS_PER_SECOND) / 1000);
+            const auto start = tick_timer64::now();
+            auto lastRun = start;
             for (;;) {
+                if (triggered) {
+                    triggered = false;
+                    if (_run_count > 0) _lastRun = _lastRun - _interval_ms;
+                }
+
+                const auto runCount = _run_count;
+                // Taken before the job, so its run time does not shift the next due time
+                const auto runStart = tick_timer64::now();
                 loop();
-                // tx_thread_sleep(std::max((_interval_ms * TX_TIMER_TICKS_PER_SECOND) / 1000, 1UL));
-                tx_thread_sleep(1);
+                if (_run_count != runCount) lastRun = runStart;
+
+                auto due = _run_count == 0 ? start + msToTicks(_delay_ms) : lastRun + msToTicks(_interval_ms);
+                if (_run_count_max != 0 && _run_count >= _run_count_max) {
+                    due = tick_timer64::time_point::max();
+                } else {
+                    const auto now = tick_timer64::now();
+                    if (due <= now) due = now + tick_timer64::duration(1);
+                }
+                sleepUntilWoken(due);
             }
         }
+
+    private:
+        /** Set by `trigger()`, consumed by the thread. */
+        volatile bool triggered{};
+
+        static tick_timer64::duration msToTicks(uint32_t ms) {
+            return tick_timer64::duration(
+                std::chrono::ceil<tick_timer::duration>(std::chrono::milliseconds(ms)).count());
+        }
     };
 }
 
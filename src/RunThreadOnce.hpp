@@ -23,6 +23,8 @@
 #define LIBSMART_STM32THREADX_RUNTHREAD_HPP
 
 #include <libsmart_config.hpp>
+#include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <functional>
 #include "Helper.hpp"
@@ -42,6 +44,12 @@ namespace Stm32ThreadX {
                      "Stm32ThreadX::RunThreadEvery"),
               RunOnce(delay_ms) { ; }
 
+        RunThreadOnce(uint32_t delay_ms, const ThreadAttributes &attr)
+            : Thread(BOUNCE(RunThreadOnce, loopThread),
+                     reinterpret_cast<ULONG>(this), attr,
+                     "Stm32ThreadX::RunThreadOnce"),
+              RunOnce(delay_ms) { ; }
+
 #ifdef LIBSMART_ENABLE_STD_FUNCTION
         explicit RunThreadOnce(const fn_t &fn)
             : RunThreadOnce(0, fn) { ; }
@@ -52,16 +60,39 @@ namespace Stm32ThreadX {
                      "Stm32ThreadX::RunThreadOnce"),
               RunOnce(delay_ms, fn) { ; }
 
+        RunThreadOnce(uint32_t delay_ms, const ThreadAttributes &attr, const fn_t &fn)
+            : Thread(BOUNCE(RunThreadOnce, loopThread),
+                     reinterpret_cast<ULONG>(this), attr,
+                     "Stm32ThreadX::RunThreadOnce"),
+              RunOnce(delay_ms, fn) { ; }
+
 #endif
 
+        /**
+         * @brief Wakes the thread to check now whether the job is due, instead of at its due time.
+         *
+         * This does not force a run. The job runs only if `RunOnce` considers it due by its own clock.
+         *
+         * Thread and ISR context callable.
+         */
+        void reevaluate() {
+            wake();
+        }
+
     protected:
+        /**
+         * The thread sleeps until the delay has passed by the tick counter, then polls `loop()` every tick until
+         * the job has run, as `RunOnce` keeps its own millisecond clock.
+         */
         void loopThread() {
-            // tx_thread_sleep((_delay_ms * TX_TIMER_TICKS_PER_SECOND) / 1000);
-            do {
+            const auto due = tick_timer64::now() + tick_timer64::duration(
+                std::chrono::ceil<tick_timer::duration>(std::chrono::milliseconds(_delay_ms)).count());
+            sleepUntilWoken(due);
+            for (;;) {
                 loop();
-                // tx_thread_sleep(std::max((_interval_ms * TX_TIMER_TICKS_PER_SECOND) / 1000, 1UL));
-                tx_thread_sleep(1);
-            } while(_run_count < 1);
+                if (_run_count >= 1) break;
+                sleepUntilWoken(std::max(due, tick_timer64::now() + tick_timer64::duration(1)));
+            }
             terminate();
         }
     };
@@ -4,6 +4,7 @@
  */
 
 #include "BaseSemaphore.hpp"
+#include "LogLevel.hpp"
 
 #if __EXCEPTIONS
 #include <stdexcept>
@@ -27,9 +28,8 @@ return ret;                                                             \
 using namespace Stm32ThreadX;
 
 UINT BaseSemaphore::create(CHAR *name_ptr, ULONG initial_count) {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::BaseSemaphore[%s]::create(\"%s\", %d)\r\n",
-                     getName(), name_ptr, initial_count);
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseSemaphore[%s]::create(\"%s\", %d)\r\n",
+                            getName(), name_ptr, initial_count);
 
     // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_semaphore_create
     const auto ret = tx_semaphore_create(
@@ -46,8 +46,7 @@ UINT BaseSemaphore::create(CHAR *name_ptr, ULONG initial_count) {
 }
 
 UINT BaseSemaphore::del() {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::BaseSemaphore[%s]::del()\r\n", getName());
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseSemaphore[%s]::del()\r\n", getName());
 
     // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_semaphore_delete
     const auto ret = tx_semaphore_delete(this);
@@ -62,8 +61,7 @@ UINT BaseSemaphore::del() {
 }
 
 UINT BaseSemaphore::ceiling_put(ULONG ceiling) {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::BaseSemaphore[%s]::ceiling_put(%d)\r\n", getName(), ceiling);
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseSemaphore[%s]::ceiling_put(%d)\r\n", getName(), ceiling);
 
     // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_semaphore_ceiling_put
     const auto ret = tx_semaphore_ceiling_put(this, ceiling);
@@ -76,13 +74,12 @@ UINT BaseSemaphore::ceiling_put(ULONG ceiling) {
 }
 
 UINT BaseSemaphore::get(ULONG wait_option) {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::BaseSemaphore[%s]::get()\r\n", getName());
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseSemaphore[%s]::get()\r\n", getName());
 
     // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_semaphore_get
     const auto ret = tx_semaphore_get(this, wait_option);
 
-    if (ret != TX_SUCCESS) {
+    if (ret != TX_SUCCESS && ret != TX_DELETED && ret != TX_NO_INSTANCE && ret != TX_WAIT_ABORTED) {
         constexpr char fmt[] = "Stm32ThreadX::BaseSemaphore[%s]: tx_semaphore_get() = 0x%02x";
         LIBSMART_HANDLE_ERROR(fmt, getName(), ret);
     }
@@ -91,8 +88,7 @@ UINT BaseSemaphore::get(ULONG wait_option) {
 
 UINT BaseSemaphore::info_get(CHAR **name, ULONG *current_value, TX_THREAD **first_suspended, ULONG *suspended_count,
                              TX_SEMAPHORE **next_semaphore) {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::BaseSemaphore[%s]::info_get()\r\n", getName());
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseSemaphore[%s]::info_get()\r\n", getName());
 
     // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_semaphore_info_get
     const auto ret = tx_semaphore_info_get(this, name, current_value,
@@ -107,8 +103,7 @@ UINT BaseSemaphore::info_get(CHAR **name, ULONG *current_value, TX_THREAD **firs
 
 #if defined(TX_SEMAPHORE_ENABLE_PERFORMANCE_INFO)
 UINT BaseSemaphore::performance_info_get(ULONG *puts, ULONG *gets, ULONG *suspensions, ULONG *timeouts) {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::BaseSemaphore[%s]::performance_info_get()\r\n", getName());
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseSemaphore[%s]::performance_info_get()\r\n", getName());
 
     // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_semaphore_performance_info_get
     const auto ret = tx_semaphore_performance_info_get(this, puts, gets, suspensions, timeouts);
@@ -122,8 +117,7 @@ UINT BaseSemaphore::performance_info_get(ULONG *puts, ULONG *gets, ULONG *suspen
 
 
 UINT BaseSemaphore::performance_system_info_get(ULONG *puts, ULONG *gets, ULONG *suspensions, ULONG *timeouts) {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::BaseSemaphore[%s]::performance_system_info_get()\r\n", getName());
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseSemaphore[%s]::performance_system_info_get()\r\n", getName());
 
     // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_semaphore_performance_system_info_get
     const auto ret = tx_semaphore_performance_system_info_get(puts, gets, suspensions, timeouts);
@@ -137,8 +131,7 @@ UINT BaseSemaphore::performance_system_info_get(ULONG *puts, ULONG *gets, ULONG
 #endif
 
 UINT BaseSemaphore::prioritize() {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::BaseSemaphore[%s]::prioritize()\r\n", getName());
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseSemaphore[%s]::prioritize()\r\n", getName());
 
     // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_semaphore_prioritize
     const auto ret = tx_semaphore_prioritize(this);
@@ -151,8 +144,7 @@ UINT BaseSemaphore::prioritize() {
 }
 
 UINT BaseSemaphore::put() {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::BaseSemaphore[%s]::put()\r\n", getName());
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseSemaphore[%s]::put()\r\n", getName());
 
     // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_semaphore_put
     const auto ret = tx_semaphore_put(this);
@@ -165,8 +157,7 @@ UINT BaseSemaphore::put() {
 }
 
 UINT BaseSemaphore::put_notify(semaphore_put_notify_callback semaphore_put_notify) {
-    log(Stm32ItmLogger::LoggerInterface::Severity::DEBUGGING)
-            ->printf("Stm32ThreadX::BaseSemaphore[%s]::put_notify()\r\n", getName());
+    LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::BaseSemaphore[%s]::put_notify()\r\n", getName());
 
     // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_semaphore_put_notify
     const auto ret = tx_semaphore_put_notify(this, semaphore_put_notify);
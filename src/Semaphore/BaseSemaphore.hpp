@@ -68,7 +68,8 @@ namespace Stm32ThreadX {
          * This method attempts to acquire the semaphore using the ThreadX semaphore get
          * API. It logs the operation for debugging purposes and records any errors in case
          * of failure. If exceptions are enabled and the operation fails, an exception
-         * is thrown.
+         * is thrown. A timeout (TX_NO_INSTANCE), an aborted wait or a deleted semaphore are
+         * returned as status codes and are not treated as errors.
          *
          * @param wait_option Specifies the maximum time to wait for the semaphore.
          *                    Can be TX_WAIT_FOREVER, TX_NO_WAIT, or a specific timeout value.
@@ -171,5 +172,19 @@ namespace Stm32ThreadX {
          *         Returns NX_SUCCESS if the callback is successfully registered, otherwise an error code.
          */
         virtual UINT put_notify(semaphore_put_notify_callback semaphore_put_notify);
+
+        /**
+         * @brief Returns the wrapper that owns a ThreadX control block.
+         *
+         * Notify callbacks registered with `put_notify()` only receive the `TX_SEMAPHORE` pointer. This maps it back
+         * to the C++ object.
+         *
+         * @param semaphore_ptr A control block that belongs to a `BaseSemaphore`.
+         * @return The owning `BaseSemaphore`.
+         */
+        static BaseSemaphore *fromNative(TX_SEMAPHORE *semaphore_ptr) { return static_cast<BaseSemaphore *>(semaphore_ptr); }
+
+    private:
+        friend class QueueSet;
     };
 }
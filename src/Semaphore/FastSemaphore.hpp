@@ -0,0 +1,151 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstring>
+#include "Loggable.hpp"
+#include "Nameable.hpp"
+#include "LogLevel.hpp"
+#include "tx_api.h"
+
+namespace Stm32ThreadX {
+    /**
+     * @class FastSemaphore
+     * @brief A counting semaphore that only enters the kernel when a thread has to block or be woken.
+     *
+     * The count lives in an atomic. `get()` and `put()` first try to take or return an instance through an atomic
+     * decrement or increment. A negative count is the number of threads waiting. Only those threads block in
+     * the wrapped `TX_SEMAPHORE`, and only a `put()` that sees a waiter calls `tx_semaphore_put()`. The
+     * uncontended case does no kernel call and no logging.
+     *
+     * The kernel semaphore holds no instances of its own, so do not pass it to `QueueSet` or query it with
+     * `tx_semaphore_info_get()`. Use `getCount()` instead.
+     *
+     * Requires atomic read-modify-write instructions, i.e. Cortex-M3 or later.
+     */
+    class FastSemaphore : protected TX_SEMAPHORE, public Stm32ItmLogger::Loggable, public Stm32Common::Nameable {
+        static_assert(std::atomic<LONG>::is_always_lock_free,
+                      "FastSemaphore: lock-free atomics are required, the core lacks exclusive access instructions");
+
+    public:
+        FastSemaphore() : FastSemaphore(&Stm32ItmLogger::emptyLogger) { ; }
+
+        explicit FastSemaphore(const char *name)
+            : FastSemaphore(name, &Stm32ItmLogger::emptyLogger) { ; }
+
+        explicit FastSemaphore(Stm32ItmLogger::LoggerInterface *logger)
+            : FastSemaphore("Stm32ThreadX::FastSemaphore", logger) { ; }
+
+        FastSemaphore(const char *name, Stm32ItmLogger::LoggerInterface *logger)
+            : TX_SEMAPHORE(), Loggable(logger), Nameable(name) { ; }
+
+        /**
+         * @brief Creates the kernel semaphore used for blocking and sets the initial count.
+         *
+         * @param initial_count The number of instances available.
+         * @return The status code of `tx_semaphore_create()`.
+         */
+        UINT create(ULONG initial_count) {
+            LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::FastSemaphore[%s]::create(%d)\r\n", getName(), initial_count);
+
+            count.store(static_cast<LONG>(initial_count), std::memory_order_relaxed);
+
+            // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_semaphore_create
+            const auto ret = tx_semaphore_create(this, getNameNonConst(), 0);
+            if (ret != TX_SUCCESS) {
+                LIBSMART_LOG(ERROR, "Stm32ThreadX::FastSemaphore[%s]: tx_semaphore_create() = 0x%02x\r\n",
+                                    getName(), ret);
+            }
+            return ret;
+        }
+
+        /**
+         * @brief Deletes the kernel semaphore. Threads blocked in `get()` return TX_DELETED.
+         *
+         * @return The status code of `tx_semaphore_delete()`.
+         */
+        UINT del() {
+            LIBSMART_LOG(DEBUGGING, "Stm32ThreadX::FastSemaphore[%s]::del()\r\n", getName());
+
+            // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_semaphore_delete
+            const auto ret = tx_semaphore_delete(this);
+            std::memset(static_cast<TX_SEMAPHORE *>(this), 0, sizeof(TX_SEMAPHORE));
+            count.store(0, std::memory_order_relaxed);
+
+            if (ret != TX_SUCCESS) {
+                LIBSMART_LOG(ERROR, "Stm32ThreadX::FastSemaphore[%s]: tx_semaphore_delete() = 0x%02x\r\n",
+                                    getName(), ret);
+            }
+            return ret;
+        }
+
+        /**
+         * @brief Acquires an instance, blocking in the kernel only if none is available.
+         *
+         * With TX_NO_WAIT the kernel is never entered, so this is ISR context callable as well.
+         *
+         * @param wait_option Amount of time, in ticks, to suspend if no instance is available. TX_NO_WAIT or
+         * TX_WAIT_FOREVER can also be used.
+         * @return TX_SUCCESS, TX_NO_INSTANCE on timeout, or the status code of `tx_semaphore_get()`.
+         */
+        UINT get(ULONG wait_option) {
+            if (wait_option == TX_NO_WAIT) {
+                auto current = count.load(std::memory_order_relaxed);
+                while (current > 0) {
+                    if (count.compare_exchange_weak(current, current - 1, std::memory_order_acquire,
+                                                    std::memory_order_relaxed)) {
+                        return TX_SUCCESS;
+                    }
+                }
+                return TX_NO_INSTANCE;
+            }
+
+            if (count.fetch_sub(1, std::memory_order_acquire) > 0) return TX_SUCCESS;
+
+            // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_semaphore_get
+            const auto ret = tx_semaphore_get(this, wait_option);
+            if (ret == TX_SUCCESS) return ret;
+
+            // Withdraw our claim. If the count is no longer negative, a put() has already handed an instance to
+            // the kernel for us, which must be taken so it does not wake a later waiter by mistake.
+            auto current = count.load(std::memory_order_relaxed);
+            while (current < 0) {
+                if (count.compare_exchange_weak(current, current + 1, std::memory_order_relaxed)) {
+                    return ret;
+                }
+            }
+            if (ret == TX_DELETED) return ret;
+            return tx_semaphore_get(this, TX_WAIT_FOREVER);
+        }
+
+        /**
+         * @brief Returns an instance and wakes a waiting thread if there is one.
+         *
+         * Thread and ISR context callable.
+         *
+         * @return TX_SUCCESS, or the status code of `tx_semaphore_put()`.
+         */
+        UINT put() {
+            if (count.fetch_add(1, std::memory_order_release) >= 0) return TX_SUCCESS;
+
+            // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_semaphore_put
+            return tx_semaphore_put(this);
+        }
+
+        /**
+         * @brief Returns the number of available instances, 0 while threads are waiting.
+         */
+        [[nodiscard]] ULONG getCount() const {
+            const auto current = count.load(std::memory_order_relaxed);
+            return current > 0 ? static_cast<ULONG>(current) : 0;
+        }
+
+    private:
+        /** Available instances, or the negated number of waiting threads. */
+        std::atomic<LONG> count{};
+    };
+}
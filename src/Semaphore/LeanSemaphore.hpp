@@ -0,0 +1,78 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <cstring>
+#include "LeanPolicies.hpp"
+#include "tx_api.h"
+
+namespace Stm32ThreadX {
+    /**
+     * @class LeanSemaphore
+     * @brief A final, non-virtual counting semaphore with inline methods.
+     *
+     * Offers the same services as `BaseSemaphore`, but without a vtable and with the name and logger as optional
+     * policies. With the default `policy::NoName` and `policy::NoLog` an object is exactly a `TX_SEMAPHORE`.
+     * `get()` and `put()` compile to a direct kernel call.
+     *
+     * @tparam NamePolicy `policy::NoName` or `policy::Named`.
+     * @tparam LogPolicy `policy::NoLog` or `policy::Logged`.
+     *
+     * @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_semaphore_create
+     */
+    template<typename NamePolicy = policy::NoName, typename LogPolicy = policy::NoLog>
+    class LeanSemaphore final : protected TX_SEMAPHORE, public NamePolicy, public LogPolicy {
+    public:
+        explicit LeanSemaphore(const char *name = "Stm32ThreadX::LeanSemaphore",
+                               Stm32ItmLogger::LoggerInterface *logger = &Stm32ItmLogger::emptyLogger)
+            : TX_SEMAPHORE(), NamePolicy(name), LogPolicy(logger) { ; }
+
+        UINT create(ULONG initial_count) {
+            const auto ret = tx_semaphore_create(this, this->getNameNonConst(), initial_count);
+            if (ret != TX_SUCCESS) {
+                this->logError("Stm32ThreadX::LeanSemaphore[%s]: tx_semaphore_create() = 0x%02x\r\n",
+                               this->getName(), ret);
+            }
+            return ret;
+        }
+
+        UINT del() {
+            const auto ret = tx_semaphore_delete(this);
+            std::memset(static_cast<TX_SEMAPHORE *>(this), 0, sizeof(TX_SEMAPHORE));
+            if (ret != TX_SUCCESS) {
+                this->logError("Stm32ThreadX::LeanSemaphore[%s]: tx_semaphore_delete() = 0x%02x\r\n",
+                               this->getName(), ret);
+            }
+            return ret;
+        }
+
+        UINT get(ULONG wait_option) {
+            return tx_semaphore_get(this, wait_option);
+        }
+
+        UINT put() {
+            return tx_semaphore_put(this);
+        }
+
+        UINT ceiling_put(ULONG ceiling) {
+            return tx_semaphore_ceiling_put(this, ceiling);
+        }
+
+        UINT prioritize() {
+            return tx_semaphore_prioritize(this);
+        }
+
+        /**
+         * @brief Returns the current count, without a kernel call.
+         */
+        [[nodiscard]] ULONG getCount() const {
+            return tx_semaphore_count;
+        }
+    };
+
+    static_assert(sizeof(LeanSemaphore<>) == sizeof(TX_SEMAPHORE),
+                  "LeanSemaphore<> must be the size of a bare TX_SEMAPHORE");
+}
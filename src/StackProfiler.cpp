@@ -0,0 +1,59 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "StackProfiler.hpp"
+#include "tx_thread.h"
+
+using namespace Stm32ThreadX;
+
+StackUsage StackProfiler::usageOf(const TX_THREAD *thread) {
+    const auto *start = static_cast<const UCHAR *>(thread->tx_thread_stack_start);
+    const auto *end = static_cast<const UCHAR *>(thread->tx_thread_stack_end) + 1;
+
+    // Stacks grow downwards, the untouched bytes are at the start of the stack memory
+    const auto *cursor = start;
+    while (cursor < end && *cursor == FILL) ++cursor;
+
+    StackUsage usage;
+    usage.size = thread->tx_thread_stack_size;
+    usage.margin = static_cast<ULONG>(cursor - start);
+    usage.used = usage.size - usage.margin;
+    return usage;
+}
+
+bool StackProfiler::isGuardIntact(const TX_THREAD *thread) {
+    const auto *start = static_cast<const UCHAR *>(thread->tx_thread_stack_start);
+    for (ULONG i = 0; i < GUARD_BYTES && i < thread->tx_thread_stack_size; ++i) {
+        if (start[i] != FILL) return false;
+    }
+    return true;
+}
+
+ULONG StackProfiler::report(report_fn fn, void *context) {
+    auto *thread = _tx_thread_created_ptr;
+    const auto count = _tx_thread_created_count;
+    for (ULONG i = 0; i < count && thread != nullptr; ++i) {
+        fn(thread, usageOf(thread), context);
+        thread = thread->tx_thread_created_next;
+    }
+    return count;
+}
+
+ULONG StackProfiler::report(Stm32ItmLogger::LoggerInterface *logger) {
+    return report([](TX_THREAD *thread, const StackUsage &usage, void *context) {
+        static_cast<Stm32ItmLogger::LoggerInterface *>(context)->printf(
+            "%-24s used %5lu / %5lu bytes, margin %5lu%s\r\n",
+            thread->tx_thread_name != nullptr ? thread->tx_thread_name : "?",
+            static_cast<unsigned long>(usage.used), static_cast<unsigned long>(usage.size),
+            static_cast<unsigned long>(usage.margin), isGuardIntact(thread) ? "" : " GUARD HIT");
+    }, logger);
+}
+
+#ifdef TX_ENABLE_STACK_CHECKING
+UINT StackProfiler::setOverflowHandler(VOID (*handler)(TX_THREAD *thread)) {
+    // @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_thread_stack_error_notify
+    return tx_thread_stack_error_notify(handler);
+}
+#endif
@@ -0,0 +1,95 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "Loggable.hpp"
+#include "tx_api.h"
+
+namespace Stm32ThreadX {
+    /**
+     * @struct StackUsage
+     * @brief Peak stack usage of a thread, in bytes.
+     */
+    struct StackUsage {
+        /** Size of the stack. */
+        ULONG size{};
+        /** Highest number of bytes ever used, measured from the fill pattern. */
+        ULONG used{};
+        /** Bytes that were never touched: size - used. */
+        ULONG margin{};
+    };
+
+    /**
+     * @class StackProfiler
+     * @brief Measures the stack high-water marks of ThreadX threads.
+     *
+     * ThreadX fills every stack with `TX_STACK_FILL` bytes when the thread is created. `Thread::createThread()`
+     * fills it itself if the kernel was built with `TX_DISABLE_STACK_FILLING`. The high-water mark is found by
+     * scanning the stack from its far end for the first byte that no longer holds the pattern, so it costs
+     * nothing while the threads run. Call it from a low-priority thread or a shell command, not from a hot path.
+     *
+     * If ThreadX is built with `TX_ENABLE_STACK_CHECKING`, the kernel also checks for overflows on every context
+     * switch, and `setOverflowHandler()` installs the function it calls.
+     */
+    class StackProfiler {
+    public:
+        /** Byte value the unused part of a stack holds. */
+#ifdef TX_STACK_FILL
+        static constexpr UCHAR FILL = static_cast<UCHAR>(TX_STACK_FILL);
+#else
+        static constexpr UCHAR FILL = 0xEF;
+#endif
+
+        /** Number of bytes at the far end of a stack that `isGuardIntact()` checks. */
+        static constexpr ULONG GUARD_BYTES = 16;
+
+        using report_fn = void (*)(TX_THREAD *thread, const StackUsage &usage, void *context);
+
+        /**
+         * @brief Returns the peak stack usage of a thread.
+         *
+         * @param thread A created thread.
+         */
+        static StackUsage usageOf(const TX_THREAD *thread);
+
+        /**
+         * @brief Checks that the far end of a stack still holds the fill pattern.
+         *
+         * @param thread A created thread.
+         * @return False if the thread came within `GUARD_BYTES` of overflowing its stack, or did overflow it.
+         */
+        static bool isGuardIntact(const TX_THREAD *thread);
+
+        /**
+         * @brief Calls a function with the stack usage of every created thread.
+         *
+         * Walks the ThreadX list of created threads, so threads not created through `Thread` are included.
+         * Threads must not be created or deleted while the report runs.
+         *
+         * @param fn Called once per thread.
+         * @param context Passed to `fn` unchanged.
+         * @return The number of threads reported.
+         */
+        static ULONG report(report_fn fn, void *context);
+
+        /**
+         * @brief Prints the stack usage of every created thread, one line per thread.
+         *
+         * @param logger The logger to print to.
+         * @return The number of threads reported.
+         */
+        static ULONG report(Stm32ItmLogger::LoggerInterface *logger);
+
+#ifdef TX_ENABLE_STACK_CHECKING
+        /**
+         * @brief Installs the function ThreadX calls when it detects a stack overflow on a context switch.
+         *
+         * @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_thread_stack_error_notify
+         */
+        static UINT setOverflowHandler(VOID (*handler)(TX_THREAD *thread));
+#endif
+    };
+}
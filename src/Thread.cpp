@@ -20,6 +20,7 @@
  */
 
 #include <cassert>
+#include <cstring>
 #include "Thread.hpp"
 
 #include "globals.hpp"
@@ -28,10 +29,30 @@
 using namespace Stm32ThreadX;
 using namespace Stm32ThreadX::native;
 
-void Thread::createThread() {
+UINT Thread::createThread() {
+    return createNative(autoStart ? TX_AUTO_START : TX_DONT_START);
+}
+
+UINT Thread::createThreadSuspended() {
+    return createNative(TX_DONT_START);
+}
+
+UINT Thread::createNative(UINT autoStartOption) {
     // https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_thread_create
     assert_param(pstack != nullptr);
     assert_param(stack_size > 0);
+#ifdef TX_DISABLE_STACK_FILLING
+    // The kernel does not fill the stack, but StackProfiler needs the pattern
+    std::memset(pstack, StackProfiler::FILL, stack_size);
+#endif
+#if LIBSMART_STM32THREADX_THREAD_NOTIFICATIONS
+    // Before the thread, an auto-started thread of higher priority runs at once and may wait for notifications
+    // https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_semaphore_create
+    const volatile auto notifyResult = tx_semaphore_create(&notifySemaphore, const_cast<char *>(threadName), 0);
+    assert_param(notifyResult == TX_SUCCESS);
+    if (notifyResult != TX_SUCCESS) return notifyResult;
+#endif
+
     const volatile auto result = tx_thread_create(
         this, // TX_THREAD *thread_ptr
         const_cast<char *>(threadName), // CHAR *name_ptr
@@ -40,42 +61,60 @@ void Thread::createThread() {
         pstack, // VOID *stack_start
         stack_size, // ULONG stack_size
         prio, // UINT priority
-        prio, // UINT preempt_threshold
-        TX_NO_TIME_SLICE, // ULONG time_slice
-        TX_DONT_START); // UINT auto_start
+        preemptThreshold == attributes::NO_PREEMPTION_THRESHOLD ? prio : priority(preemptThreshold), // UINT preempt_threshold
+        timeSlice, // ULONG time_slice
+        autoStartOption); // UINT auto_start
     assert_param(result == TX_SUCCESS);
+#if LIBSMART_STM32THREADX_THREAD_NOTIFICATIONS
+    if (result != TX_SUCCESS) tx_semaphore_delete(&notifySemaphore);
+#endif
+    return result;
 }
 
-void Thread::createThread(const char *threadName) {
+UINT Thread::createThread(const char *threadName) {
     this->threadName = threadName;
-    createThread();
+    return createThread();
 }
 
-void Thread::createThread(VOID *stack, ULONG stackSize) {
+UINT Thread::createThread(VOID *stack, ULONG stackSize) {
     this->setStack(stack, stackSize);
-    createThread();
+    return createThread();
 }
 
-void Thread::createThread(void *stack, ULONG stackSize, const char *threadName) {
+UINT Thread::createThread(void *stack, ULONG stackSize, const char *threadName) {
     this->setStack(stack, stackSize);
     this->threadName = threadName;
-    createThread();
+    return createThread();
 }
 
 void Thread::createAndResumeThread(void *stack, ULONG stackSize, const char *threadName) {
     if(tx_thread_id == 0) {
         createThread(stack, stackSize, threadName);
-        resume();
+        if (!autoStart) resume();
     }
 }
 
 Thread::~Thread() {
-    if (tx_thread_state != TX_COMPLETED) {
+    deleteThread();
+}
+
+void Thread::deleteThread() {
+    if (tx_thread_id == 0) return;
+
+    if (tx_thread_state != TX_COMPLETED && tx_thread_state != TX_TERMINATED) {
         const volatile auto result = tx_thread_terminate(this);
         assert_param(result == TX_SUCCESS);
     }
+    // https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_thread_delete
     const volatile auto result = tx_thread_delete(this);
     assert_param(result == TX_SUCCESS);
+#if LIBSMART_STM32THREADX_THREAD_NOTIFICATIONS
+    if (notifySemaphore.tx_semaphore_id != 0) {
+        tx_semaphore_delete(&notifySemaphore);
+    }
+    notifyValue = 0;
+    notifyPending = false;
+#endif
 }
 
 
@@ -108,8 +147,15 @@ Thread::priority Thread::getPriority() const {
 }
 
 void Thread::setPriority(priority prio) {
+    // Also used by the next createThread()
+    this->prio = prio;
+    if (tx_thread_id == 0) return;
+
+    // tx_thread_priority_change() also sets the preemption threshold to the new priority
     priority::value_type old_prio;
-    tx_thread_priority_change(this, prio, &old_prio);
+    if (tx_thread_priority_change(this, prio, &old_prio) == TX_SUCCESS) {
+        preemptThreshold = attributes::NO_PREEMPTION_THRESHOLD;
+    }
 }
 
 void Thread::setStack(void *stackPointer, const std::uint32_t stackSize) {
@@ -119,6 +165,70 @@ void Thread::setStack(void *stackPointer, const std::uint32_t stackSize) {
     stack_size = stackSize;
 }
 
+Thread::priority Thread::getPreemptionThreshold() const {
+    if (tx_thread_id == 0) {
+        return preemptThreshold == attributes::NO_PREEMPTION_THRESHOLD ? prio : priority(preemptThreshold);
+    }
+    return tx_thread_user_preempt_threshold;
+}
+
+UINT Thread::setPreemptionThreshold(priority threshold) {
+    if (tx_thread_id == 0) {
+        preemptThreshold = threshold;
+        return TX_SUCCESS;
+    }
+    // https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_thread_preemption_change
+    UINT old_threshold;
+    const auto result = tx_thread_preemption_change(this, threshold, &old_threshold);
+    if (result == TX_SUCCESS) preemptThreshold = threshold;
+    return result;
+}
+
+ULONG Thread::getTimeSlice() const {
+    return tx_thread_id == 0 ? timeSlice : tx_thread_new_time_slice;
+}
+
+UINT Thread::setTimeSlice(ULONG ticks) {
+    if (tx_thread_id == 0) {
+        timeSlice = ticks;
+        return TX_SUCCESS;
+    }
+    // https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_thread_time_slice_change
+    ULONG old_time_slice;
+    const auto result = tx_thread_time_slice_change(this, ticks, &old_time_slice);
+    if (result == TX_SUCCESS) timeSlice = ticks;
+    return result;
+}
+
+void Thread::wake() {
+    // Under the lock, so the thread cannot leave the sleep and block elsewhere before the abort
+    const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+    wakePending = true;
+    // https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_thread_wait_abort
+    if (sleepingUntilWoken && tx_thread_wait_abort(this) == TX_SUCCESS) wakePending = false;
+    tx_interrupt_control(posture);
+}
+
+void Thread::sleepUntilWoken(const tick_timer64::time_point &deadline) {
+    const auto now = tick_timer64::now();
+    if (deadline <= now) return;
+
+    // Never pass TX_WAIT_FOREVER, a longer sleep simply returns early
+    const auto remaining = toTicks(deadline) - toTicks(now);
+    const ULONG ticks = remaining < TX_WAIT_FOREVER ? static_cast<ULONG>(remaining) : TX_WAIT_FOREVER - 1;
+
+    const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+    const bool woken = wakePending;
+    wakePending = false;
+    sleepingUntilWoken = !woken;
+    tx_interrupt_control(posture);
+    if (woken) return;
+
+    // Returns TX_WAIT_ABORTED after wake()
+    tx_thread_sleep(ticks);
+    sleepingUntilWoken = false;
+}
+
 Thread::id Thread::getId() const {
     return id(this);
 }
@@ -127,6 +237,18 @@ const char *Thread::getName() const {
     return threadName;
 }
 
+StackUsage Thread::getStackUsage() const {
+    return StackProfiler::usageOf(this);
+}
+
+bool Thread::isStackGuardIntact() const {
+    return StackProfiler::isGuardIntact(this);
+}
+
+ThreadStats::ThreadSample Thread::getCpuTime() const {
+    return ThreadStats::of(this);
+}
+
 Thread::state Thread::getState() const {
     state s;
     switch (tx_thread_state) {
@@ -147,7 +269,8 @@ Thread::state Thread::getState() const {
 }
 
 Thread *Thread::getCurrent() {
-    return reinterpret_cast<Thread *>(tx_thread_identify());
+    // Not a reinterpret_cast: the vtable pointer puts the TX_THREAD base behind the start of the object
+    return static_cast<Thread *>(tx_thread_identify());
 }
 
 void this_thread::yield() {
@@ -163,6 +286,105 @@ void this_thread::sleepFor(tick_timer::duration rel_time) {
     assert(result == TX_SUCCESS);
 }
 
+void this_thread::sleepUntil(const tick_timer::time_point &abs_time) {
+    const auto remaining = static_cast<LONG>(toTicks(abs_time) - tx_time_get());
+    if (remaining <= 0) return;
+    sleepFor(tick_timer::duration(static_cast<ULONG>(remaining)));
+}
+
+void this_thread::sleepUntil(const tick_timer64::time_point &abs_time) {
+    // Never pass TX_WAIT_FOREVER to tx_thread_sleep()
+    constexpr tick_timer64::rep maxSleep = TX_WAIT_FOREVER - 1;
+    for (;;) {
+        const auto now = tick_timer64::now();
+        if (now >= abs_time) return;
+        const auto remaining = toTicks(abs_time) - toTicks(now);
+        sleepFor(tick_timer::duration(static_cast<ULONG>(remaining < maxSleep ? remaining : maxSleep)));
+    }
+}
+
+#if LIBSMART_STM32THREADX_THREAD_NOTIFICATIONS
+
+UINT Thread::notify(notify_value value, notifyAction action) {
+    const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+    const bool wasPending = notifyPending;
+    if (action == notifyAction::NO_OVERWRITE && wasPending) {
+        tx_interrupt_control(posture);
+        return TX_NOT_AVAILABLE;
+    }
+    switch (action) {
+        case notifyAction::SET_BITS:
+            notifyValue = notifyValue | value;
+            break;
+        case notifyAction::INCREMENT:
+            notifyValue = notifyValue + 1;
+            break;
+        case notifyAction::OVERWRITE:
+        case notifyAction::NO_OVERWRITE:
+            notifyValue = value;
+            break;
+    }
+    notifyPending = true;
+    tx_interrupt_control(posture);
+
+    // Only the first of several pending notifications hands a token to the waiter
+    if (wasPending) return TX_SUCCESS;
+
+    // https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_semaphore_ceiling_put
+    const auto ret = tx_semaphore_ceiling_put(&notifySemaphore, 1);
+    // A stale token left by a wait that timed out still wakes the waiter, the notification is recorded
+    return ret == TX_CEILING_EXCEEDED ? TX_SUCCESS : ret;
+}
+
+bool Thread::notifyWait(ULONG timeout, notify_flag clrAtEntry, notify_flag clrAtExit, notify_value *received) {
+    auto posture = tx_interrupt_control(TX_INT_DISABLE);
+    if (!notifyPending) {
+        notifyValue = notifyValue & ~clrAtEntry;
+    }
+    tx_interrupt_control(posture);
+
+    const auto start = tx_time_get();
+    ULONG remaining = timeout;
+    for (;;) {
+        const auto ret = tx_semaphore_get(&notifySemaphore, remaining);
+
+        posture = tx_interrupt_control(TX_INT_DISABLE);
+        const bool pending = notifyPending;
+        if (pending) {
+            notifyPending = false;
+            if (received != nullptr) *received = notifyValue;
+            notifyValue = notifyValue & ~clrAtExit;
+        }
+        tx_interrupt_control(posture);
+
+        if (pending) return true;
+        if (ret != TX_SUCCESS) return false;
+
+        // A stale token of a notification that was taken after an earlier timeout. Wait for the rest of the time.
+        if (timeout != TX_WAIT_FOREVER) {
+            const auto elapsed = tx_time_get() - start;
+            if (elapsed >= timeout) return false;
+            remaining = timeout - elapsed;
+        }
+    }
+}
+
+bool this_thread::notify_wait_for(const tick_timer::duration &rel_time,
+                                  Thread::notify_flag clr_at_entry, Thread::notify_flag clr_at_exit,
+                                  Thread::notify_value *received) {
+    return Thread::getCurrent()->notifyWait(toTicks(rel_time), clr_at_entry, clr_at_exit, received);
+}
+
+Thread::notify_value this_thread::notify_value_wait_for(const tick_timer::duration &rel_time,
+                                                        Thread::notify_flag clr_at_entry,
+                                                        Thread::notify_flag clr_at_exit) {
+    Thread::notify_value value = 0;
+    notify_wait_for(rel_time, clr_at_entry, clr_at_exit, &value);
+    return value;
+}
+
+#endif
+
 
 #ifndef TX_DISABLE_NOTIFY_CALLBACKS
 
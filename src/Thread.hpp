@@ -24,10 +24,20 @@
 
 #include <cstdint>
 #include <type_traits>
+#include <libsmart_config.hpp>
 #include "tx_api.h"
+#include "StackProfiler.hpp"
+#include "ThreadStats.hpp"
 #include "TickTimer.hpp"
 
 namespace Stm32ThreadX {
+#if LIBSMART_STM32THREADX_THREAD_NOTIFICATIONS
+    namespace this_thread {
+        bool notify_wait_for(const tick_timer::duration &rel_time, ULONG clr_at_entry, ULONG clr_at_exit,
+                             ULONG *received);
+    }
+#endif
+
     /**
      * @class thread
      *
@@ -51,15 +61,17 @@ namespace Stm32ThreadX {
          * @note The name can be set using the `setName()` function.
          * See `thread::thread()` for default values of `name` and `stack_size`.
          *
+         * @return The status code of `tx_thread_create()`.
+         *
          * @see thread::thread(), setName()
          */
-        void createThread();
+        UINT createThread();
 
-        void createThread(const char *threadName);
+        UINT createThread(const char *threadName);
 
-        void createThread(VOID *stack, ULONG stackSize);
+        UINT createThread(VOID *stack, ULONG stackSize);
 
-        void createThread(VOID *stack, ULONG stackSize, const char *threadName);
+        UINT createThread(VOID *stack, ULONG stackSize, const char *threadName);
 
 
         /**
@@ -212,6 +224,92 @@ namespace Stm32ThreadX {
             value_type value_;
         };
 
+        /**
+         * @class attributes
+         * @brief The creation parameters of a thread, as a value type.
+         *
+         * Defaults match the plain constructors: priority 1, no preemption threshold, no time slicing, created
+         * suspended and without a stack.
+         *
+         * @code
+         * static constexpr auto sensorAttributes = Thread::attributes()
+         *         .withPriority(6)
+         *         .withPreemptionThreshold(4);
+         * @endcode
+         */
+        class attributes {
+        public:
+            /** Passed as preemption threshold, disables it by using the priority of the thread. */
+            static constexpr priority::value_type NO_PREEMPTION_THRESHOLD = TX_MAX_PRIORITIES;
+
+            /**
+             * @brief Sets the priority of the thread.
+             */
+            constexpr attributes withPriority(priority prio) const {
+                attributes result = *this;
+                result.prio = prio;
+                return result;
+            }
+
+            /**
+             * @brief Sets the preemption threshold.
+             *
+             * Only threads with a priority higher (numerically lower) than the threshold can preempt the thread.
+             * Giving cooperating threads the same threshold stops them from preempting each other.
+             *
+             * @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_thread_preemption_change
+             */
+            constexpr attributes withPreemptionThreshold(priority threshold) const {
+                attributes result = *this;
+                result.preemptThreshold = threshold;
+                return result;
+            }
+
+            /**
+             * @brief Sets the time slice in ticks, TX_NO_TIME_SLICE disables time slicing.
+             *
+             * @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_thread_time_slice_change
+             */
+            constexpr attributes withTimeSlice(ULONG ticks) const {
+                attributes result = *this;
+                result.timeSlice = ticks;
+                return result;
+            }
+
+            /**
+             * @brief Starts the thread as soon as it is created, without `resume()`.
+             */
+            constexpr attributes withAutoStart(bool start = true) const {
+                attributes result = *this;
+                result.autoStart = start;
+                return result;
+            }
+
+            /**
+             * @brief Sets the stack memory. Ignored by `StaticThread`, which brings its own.
+             */
+            constexpr attributes withStack(void *stackPointer, std::uint32_t stackSize) const {
+                attributes result = *this;
+                result.stack = stackPointer;
+                result.stackSize = stackSize;
+                return result;
+            }
+
+            /**
+             * @brief Returns the preemption threshold passed to ThreadX, i.e. the priority if none is set.
+             */
+            [[nodiscard]] constexpr priority getPreemptionThreshold() const {
+                return preemptThreshold == NO_PREEMPTION_THRESHOLD ? prio : priority(preemptThreshold);
+            }
+
+            priority prio{};
+            priority::value_type preemptThreshold{NO_PREEMPTION_THRESHOLD};
+            ULONG timeSlice{TX_NO_TIME_SLICE};
+            bool autoStart{false};
+            void *stack{};
+            std::uint32_t stackSize{};
+        };
+
         /**
          * @brief Get the priority of the thread.
          *
@@ -233,6 +331,10 @@ namespace Stm32ThreadX {
          *
          * @note The thread's priority can range from the minimum priority value (0) to the maximum priority value (native::TOP_PRIORITY).
          *
+         * Before `createThread()` this only stores the value for creation. The value is also kept for a later
+         * re-creation of the thread. On a created thread ThreadX also resets the preemption threshold to the new
+         * priority, so a threshold set before is dropped.
+         *
          * @param prio The new priority value for the thread.
          *
          * @see thread::priority, _txe_thread_priority_change()
@@ -249,6 +351,113 @@ namespace Stm32ThreadX {
          */
         void setStack(void *stackPointer, std::uint32_t stackSize);
 
+        /**
+         * @brief Returns the preemption threshold of the thread.
+         */
+        [[nodiscard]] priority getPreemptionThreshold() const;
+
+        /**
+         * @brief Changes the preemption threshold of the thread.
+         *
+         * Before `createThread()` this only stores the value for creation. A threshold equal to the priority
+         * disables preemption-threshold scheduling. Note that `setPriority()` resets the threshold to the new
+         * priority.
+         *
+         * @param threshold The new threshold, at most the priority of the thread.
+         * @return TX_SUCCESS, TX_THRESH_ERROR, or TX_FEATURE_NOT_ENABLED with TX_DISABLE_PREEMPTION_THRESHOLD.
+         *
+         * @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_thread_preemption_change
+         */
+        UINT setPreemptionThreshold(priority threshold);
+
+        /**
+         * @brief Returns the time slice of the thread in ticks, or TX_NO_TIME_SLICE.
+         */
+        [[nodiscard]] ULONG getTimeSlice() const;
+
+        /**
+         * @brief Changes the time slice of the thread.
+         *
+         * Before `createThread()` this only stores the value for creation. ThreadX ignores the time slice of a
+         * thread that has a preemption threshold.
+         *
+         * @param ticks The new time slice in ticks, or TX_NO_TIME_SLICE.
+         * @return The status code of `tx_thread_time_slice_change()`.
+         *
+         * @see https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_thread_time_slice_change
+         */
+        UINT setTimeSlice(ULONG ticks);
+
+        /**
+         * @brief Ends a `sleepUntilWoken()` of this thread early.
+         *
+         * Uses `tx_thread_wait_abort()`, but only while the thread sleeps in `sleepUntilWoken()`, so blocking
+         * calls of the thread elsewhere are never aborted. The notification word is not touched. A wake that
+         * arrives while the thread is not sleeping there ends its next `sleepUntilWoken()` at once. Only a wake
+         * in the few instructions between that check and the start of the sleep is lost, the sleep then lasts
+         * until its deadline.
+         *
+         * Thread and ISR context callable.
+         */
+        void wake();
+
+        /**
+         * @brief Returns the peak stack usage and the remaining margin of the thread.
+         *
+         * @see StackProfiler
+         */
+        [[nodiscard]] StackUsage getStackUsage() const;
+
+        /**
+         * @brief Checks that the thread never came close to overflowing its stack.
+         *
+         * @see StackProfiler::isGuardIntact()
+         */
+        [[nodiscard]] bool isStackGuardIntact() const;
+
+        /**
+         * @brief Returns the run count and, with the execution profile kit, the CPU time of the thread.
+         *
+         * `Thread::getCurrent()->getCpuTime()` returns the values of the calling thread.
+         *
+         * @see ThreadStats
+         */
+        [[nodiscard]] ThreadStats::ThreadSample getCpuTime() const;
+
+#if LIBSMART_STM32THREADX_THREAD_NOTIFICATIONS
+        using notify_value = ULONG;
+        using notify_flag = ULONG;
+
+        /**
+         * @brief How `notify()` changes the notification word of the thread.
+         */
+        enum class notifyAction {
+            /** The value is ORed into the notification word. */
+            SET_BITS,
+            /** The notification word is incremented, the value is ignored. */
+            INCREMENT,
+            /** The notification word is replaced by the value. */
+            OVERWRITE,
+            /** The notification word is replaced by the value, unless a notification is still pending. */
+            NO_OVERWRITE
+        };
+
+        /**
+         * @brief Sends a direct notification to this thread.
+         *
+         * Every thread carries a 32-bit notification word. A notification updates the word and wakes the thread
+         * if it waits in `this_thread::notify_wait_for()`. Notifications that arrive before the thread waits
+         * are kept pending. This replaces a `Semaphore` or `EventFlags` object for one-to-one signaling.
+         *
+         * Thread and ISR context callable.
+         *
+         * @param value The value to apply to the notification word.
+         * @param action How the value is applied.
+         * @return TX_SUCCESS, or TX_NOT_AVAILABLE if `notifyAction::NO_OVERWRITE` found a pending notification.
+         */
+        UINT notify(notify_value value, notifyAction action = notifyAction::SET_BITS);
+#endif
+
 #ifndef TX_DISABLE_NOTIFY_CALLBACKS
 
         private:
@@ -285,6 +494,49 @@ namespace Stm32ThreadX {
         Thread(threadEntry func, ULONG param,
                priority prio, const char *name) : Thread(nullptr, 0, func, param, prio, name) { ; }
 
+        Thread(void *pstack, std::uint32_t stack_size,
+               threadEntry func, ULONG param,
+               const attributes &attr, const char *threadName) : Thread(pstack, stack_size, func, param, attr.prio,
+                                                                        threadName) {
+            preemptThreshold = attr.preemptThreshold;
+            timeSlice = attr.timeSlice;
+            autoStart = attr.autoStart;
+        }
+
+        Thread(threadEntry func, ULONG param,
+               const attributes &attr, const char *name) : Thread(attr.stack, attr.stackSize, func, param, attr,
+                                                                  name) { ; }
+
+        /**
+         * @brief Sleeps until the deadline or until `wake()` is called. Must be called by the thread itself.
+         *
+         * Returns at once if `wake()` was called since the last sleep. Callers must expect early returns.
+         *
+         * @param deadline The latest time to return.
+         */
+        void sleepUntilWoken(const tick_timer64::time_point &deadline);
+
+        /**
+         * @brief Creates the thread suspended, even if the attributes ask for auto-start.
+         *
+         * Lets a subclass finish its setup before the thread runs, then `resume()` it if `isAutoStart()`.
+         *
+         * @return The status code of `tx_thread_create()`.
+         */
+        UINT createThreadSuspended();
+
+        /**
+         * @brief Returns true if the thread is started by `createThread()` itself.
+         */
+        [[nodiscard]] bool isAutoStart() const { return autoStart; }
+
+        /**
+         * @brief Terminates and deletes the ThreadX thread, so `createThread()` can be called again.
+         *
+         * Does nothing if the thread was not created. The stack is left to the owner.
+         */
+        void deleteThread();
+
         // Thread(threadEntry func, const char *name)
         // : Thread(nullptr, 0, func, reinterpret_cast<ULONG>(this), priority(), name) { ; }
 
@@ -297,14 +549,43 @@ namespace Stm32ThreadX {
 
         Thread &operator=(const Thread &&) = delete;
 
+        UINT createNative(UINT autoStartOption);
+
         void *pstack{};
         std::uint32_t stack_size{};
         threadEntry func{};
         ULONG param{};
         priority prio{};
         const char *threadName{};
+        priority::value_type preemptThreshold{attributes::NO_PREEMPTION_THRESHOLD};
+        ULONG timeSlice{TX_NO_TIME_SLICE};
+        bool autoStart{false};
+
+#if LIBSMART_STM32THREADX_THREAD_NOTIFICATIONS
+        bool notifyWait(ULONG timeout, notify_flag clrAtEntry, notify_flag clrAtExit, notify_value *received);
+
+        friend bool this_thread::notify_wait_for(const tick_timer::duration &rel_time, ULONG clr_at_entry,
+                                                 ULONG clr_at_exit, ULONG *received);
+
+        /** Holds one token while a notification is pending, so the waiting thread can block on it. */
+        TX_SEMAPHORE notifySemaphore{};
+        volatile notify_value notifyValue{};
+        volatile bool notifyPending{};
+#endif
+
+        /** True while the thread sleeps in `sleepUntilWoken()`, the only wait `wake()` may abort. */
+        volatile bool sleepingUntilWoken{};
+        /** Set by a `wake()` that found the thread not sleeping, ends its next `sleepUntilWoken()` at once. */
+        volatile bool wakePending{};
     };
 
+    /**
+     * @brief The creation parameters of a thread.
+     *
+     * @see Thread::attributes
+     */
+    using ThreadAttributes = Thread::attributes;
+
 
     /**
      * @class static_thread
@@ -333,6 +614,12 @@ namespace Stm32ThreadX {
                      func, param, prio, name) {
         }
 
+        StaticThread(threadEntry func, ULONG param,
+                     const attributes &attr, const char *name = DEFAULT_NAME)
+            : Thread(stack_, sizeof(stack_) / sizeof(stack_[0]),
+                     func, param, attr, name) {
+        }
+
         template<typename T>
         StaticThread(typename std::enable_if<(sizeof(T) <= sizeof(std::uintptr_t)),
                          void (*)(T)>::type func, T arg,
@@ -468,17 +755,57 @@ namespace Stm32ThreadX {
             sleepFor(abs_time - Clock::now());
         }
 
-#if 0 && (configUSE_TASK_NOTIFICATIONS == 1)
+        /**
+         * @brief Blocks the current thread until the tick counter reaches the deadline.
+         *
+         * Returns at once if the deadline has passed. Tick counter wrap-around is handled, so the deadline must
+         * be less than 2^31 ticks away.
+         *
+         * @param abs_time The deadline.
+         */
+        void sleepUntil(const tick_timer::time_point &abs_time);
 
-        bool notify_wait_for(const tick_timer::duration& rel_time,
-                    Thread::notify_flag clr_at_entry = 0, thread::notify_flag clr_at_exit = 0,
-                    Thread::notify_flag *received = nullptr);
+        /**
+         * @brief Blocks the current thread until the extended tick counter reaches the deadline.
+         *
+         * Returns at once if the deadline has passed. Sleeps longer than a 32-bit tick count are split. Waking
+         * up late, e.g. after preemption, does not shift later deadlines computed from this one, so loops that
+         * advance an absolute deadline do not drift.
+         *
+         * @param abs_time The deadline.
+         *
+         * @see PeriodicTicker
+         */
+        void sleepUntil(const tick_timer64::time_point &abs_time);
 
-            notify_value notify_value_wait_for(const tick_timer::duration& rel_time,
-                    Thread::notify_flag clr_at_entry = 0, thread::notify_flag clr_at_exit = 0,
-                    Thread::notify_flag *received = nullptr);
+#if LIBSMART_STM32THREADX_THREAD_NOTIFICATIONS
+        /**
+         * @brief Waits for a direct notification sent with `Thread::notify()`.
+         *
+         * Returns immediately if a notification is already pending.
+         *
+         * @param rel_time The maximum time to wait. Use `infinity` to wait forever.
+         * @param clr_at_entry Bits cleared in the notification word before waiting, unless a notification is
+         *                     already pending.
+         * @param clr_at_exit Bits cleared in the notification word after a notification was received.
+         * @param received Optional pointer that receives the notification word, before `clr_at_exit` is applied.
+         * @return True if a notification was received, false on timeout.
+         */
+        bool notify_wait_for(const tick_timer::duration &rel_time,
+                             Thread::notify_flag clr_at_entry = 0, Thread::notify_flag clr_at_exit = 0,
+                             Thread::notify_value *received = nullptr);
 
-#endif // (configUSE_TASK_NOTIFICATIONS == 1)
+        /**
+         * @brief Waits for a direct notification and returns the notification word.
+         *
+         * @see notify_wait_for()
+         *
+         * @return The notification word before `clr_at_exit` is applied, or 0 on timeout.
+         */
+        Thread::notify_value notify_value_wait_for(const tick_timer::duration &rel_time,
+                                                   Thread::notify_flag clr_at_entry = 0,
+                                                   Thread::notify_flag clr_at_exit = ~Thread::notify_flag());
+#endif
     }
 }
 
@@ -0,0 +1,383 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "EventFlags/EventFlags.hpp"
+#include "Semaphore/FastSemaphore.hpp"
+#include "Stm32ThreadX.hpp"
+#include "Thread.hpp"
+
+namespace Stm32ThreadX {
+    namespace detail {
+        /**
+         * A callable stored in a fixed buffer, so tasks never allocate.
+         */
+        template<std::size_t Size>
+        class PoolTask {
+        public:
+            PoolTask() = default;
+
+            PoolTask(const PoolTask &) = delete;
+
+            PoolTask &operator=(const PoolTask &) = delete;
+
+            template<typename F>
+            void emplace(F &&fn) {
+                using fn_t = std::decay_t<F>;
+                static_assert(sizeof(fn_t) <= Size, "ThreadPool: callable too large, raise TaskSize");
+                static_assert(alignof(fn_t) <= alignof(std::max_align_t), "ThreadPool: callable over-aligned");
+
+                static constexpr ops_t fnOps{
+                    [](void *self) { (*static_cast<fn_t *>(self))(); },
+                    [](void *dst, void *src) {
+                        new(dst) fn_t(std::move(*static_cast<fn_t *>(src)));
+                        static_cast<fn_t *>(src)->~fn_t();
+                    },
+                    [](void *self) { static_cast<fn_t *>(self)->~fn_t(); }
+                };
+                new(storage) fn_t(std::forward<F>(fn));
+                ops = &fnOps;
+            }
+
+            /** Moves the callable into an empty task. */
+            void moveTo(PoolTask &dst) {
+                ops->relocate(dst.storage, storage);
+                dst.ops = ops;
+                dst.record = record;
+                ops = nullptr;
+            }
+
+            /** Calls and destroys the callable. */
+            void run() {
+                ops->invoke(storage);
+                ops->destroy(storage);
+                ops = nullptr;
+            }
+
+            UINT record{};
+
+        private:
+            struct ops_t {
+                void (*invoke)(void *self);
+                void (*relocate)(void *dst, void *src);
+                void (*destroy)(void *self);
+            };
+
+            const ops_t *ops{};
+            alignas(std::max_align_t) unsigned char storage[Size]{};
+        };
+
+        /**
+         * Bounded lock-free multi-producer/multi-consumer queue of tasks (D. Vyukov). Every cell carries a
+         * sequence number that tells producers and consumers whether it is free or filled for their position.
+         */
+        template<typename Task, std::size_t Depth>
+        class TaskQueue {
+            static_assert(Depth >= 2 && (Depth & (Depth - 1)) == 0, "ThreadPool: QueueDepth must be a power of two");
+
+        public:
+            TaskQueue() {
+                for (std::size_t i = 0; i < Depth; ++i) {
+                    cells[i].sequence.store(i, std::memory_order_relaxed);
+                }
+            }
+
+            /** Claims a free cell and lets `fill` construct the task in place. */
+            template<typename Fill>
+            bool push(Fill &&fill) {
+                auto pos = enqueuePos.load(std::memory_order_relaxed);
+                for (;;) {
+                    auto &cell = cells[pos & (Depth - 1)];
+                    const auto seq = cell.sequence.load(std::memory_order_acquire);
+                    const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+                    if (diff == 0) {
+                        if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                            fill(cell.task);
+                            cell.sequence.store(pos + 1, std::memory_order_release);
+                            return true;
+                        }
+                    } else if (diff < 0) {
+                        return false;
+                    } else {
+                        pos = enqueuePos.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            /** Moves the oldest task into `task`. Used by the owner and by stealing workers alike. */
+            bool pop(Task &task) {
+                auto pos = dequeuePos.load(std::memory_order_relaxed);
+                for (;;) {
+                    auto &cell = cells[pos & (Depth - 1)];
+                    const auto seq = cell.sequence.load(std::memory_order_acquire);
+                    const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+                    if (diff == 0) {
+                        if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                            cell.task.moveTo(task);
+                            cell.sequence.store(pos + Depth, std::memory_order_release);
+                            return true;
+                        }
+                    } else if (diff < 0) {
+                        return false;
+                    } else {
+                        pos = dequeuePos.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+        private:
+            struct cell_t {
+                std::atomic<std::size_t> sequence{};
+                Task task;
+            };
+
+            cell_t cells[Depth];
+            std::atomic<std::size_t> enqueuePos{};
+            std::atomic<std::size_t> dequeuePos{};
+        };
+    }
+
+    /**
+     * @class ThreadPool
+     * @brief A fixed set of worker threads that share bursts of short jobs.
+     *
+     * Every worker is a `StaticThread` with its own bounded lock-free task queue. `submit()` spreads tasks over
+     * the queues round robin, and a worker whose queue is empty steals from the other queues, so a burst does
+     * not wait behind one busy worker. Idle workers sleep on a `FastSemaphore` that counts the queued tasks.
+     * Callables are stored in a `TaskSize` byte buffer, nothing is allocated.
+     *
+     * `submit()` returns a `Handle` that can be polled or waited on. Up to `MaxPending` tasks (at most 32) can
+     * be in flight at once, as each one uses a bit of an internal `EventFlags` group for its completion.
+     *
+     * Requires atomic read-modify-write instructions, i.e. Cortex-M3 or later.
+     *
+     * @tparam Workers The number of worker threads.
+     * @tparam StackSize The stack size of each worker in bytes.
+     * @tparam QueueDepth The number of tasks each worker queue can hold. Must be a power of two.
+     * @tparam TaskSize The maximum size of a callable, including its captures.
+     * @tparam MaxPending The maximum number of tasks submitted and not yet finished, 1 to 32.
+     */
+    template<std::size_t Workers, std::size_t StackSize, std::size_t QueueDepth,
+        std::size_t TaskSize = 4 * sizeof(void *), std::size_t MaxPending = 32>
+    class ThreadPool {
+        static_assert(Workers > 0, "ThreadPool: Workers must be greater than 0");
+        static_assert(MaxPending >= 1 && MaxPending <= 32, "ThreadPool: MaxPending must be between 1 and 32");
+
+        using task_t = detail::PoolTask<TaskSize>;
+
+    public:
+        /**
+         * @class Handle
+         * @brief Tracks the completion of one submitted task. Move-only.
+         */
+        class Handle {
+        public:
+            Handle() = default;
+
+            Handle(Handle &&other) noexcept
+                : pool(other.pool), record(other.record) {
+                other.pool = nullptr;
+            }
+
+            Handle &operator=(Handle &&other) noexcept {
+                if (this != &other) {
+                    reset();
+                    pool = other.pool;
+                    record = other.record;
+                    other.pool = nullptr;
+                }
+                return *this;
+            }
+
+            Handle(const Handle &) = delete;
+
+            Handle &operator=(const Handle &) = delete;
+
+            ~Handle() { reset(); }
+
+            /**
+             * @brief Returns false if the task could not be submitted.
+             */
+            [[nodiscard]] bool valid() const { return pool != nullptr; }
+
+            /**
+             * @brief Returns true once the task has finished, without a kernel call.
+             */
+            [[nodiscard]] bool isDone() const {
+                return pool != nullptr && pool->completed.isSet(bitOf(record));
+            }
+
+            /**
+             * @brief Waits for the task to finish.
+             *
+             * @param wait_option The maximum number of ticks to wait, TX_NO_WAIT or TX_WAIT_FOREVER.
+             * @return TX_SUCCESS, TX_NO_EVENTS on timeout, or TX_PTR_ERROR for an invalid handle.
+             */
+            UINT wait(ULONG wait_option) {
+                if (pool == nullptr) return TX_PTR_ERROR;
+                ULONG actualFlags{};
+                return pool->completed.get(bitOf(record), EventFlags::getOption_t::OR, actualFlags,
+                                           EventFlags::waitOption_t{wait_option});
+            }
+
+            /**
+             * @brief Detaches from the task. The task still runs.
+             */
+            void reset() {
+                if (pool != nullptr) {
+                    pool->releaseRecord(record);
+                    pool = nullptr;
+                }
+            }
+
+        private:
+            friend class ThreadPool;
+
+            Handle(ThreadPool *pool, UINT record)
+                : pool(pool), record(record) { ; }
+
+            ThreadPool *pool{};
+            UINT record{};
+        };
+
+        ThreadPool() : ThreadPool("Stm32ThreadX::ThreadPool") { ; }
+
+        explicit ThreadPool(const char *name)
+            : pending(name), completed(name), name(name) {
+            for (std::size_t i = 0; i < Workers; ++i) {
+                workers[i].owner = this;
+                workers[i].index = i;
+            }
+        }
+
+        /**
+         * @brief Creates the synchronization objects and starts the workers.
+         *
+         * @param prio The priority of the worker threads.
+         * @return TX_SUCCESS, or the status code of the first creation that failed.
+         */
+        UINT create(Thread::priority prio) {
+            auto ret = pending.create(0);
+            if (ret != TX_SUCCESS) return ret;
+            ret = completed.create();
+            if (ret != TX_SUCCESS) return ret;
+
+            for (auto &worker: workers) {
+                ret = worker.thread.createThread(name);
+                if (ret != TX_SUCCESS) return ret;
+                worker.thread.setPriority(prio);
+                worker.thread.resume();
+            }
+            return TX_SUCCESS;
+        }
+
+        /**
+         * @brief Queues a callable for execution on a worker.
+         *
+         * Thread and ISR context callable.
+         *
+         * @param fn A callable without arguments. Its result is discarded.
+         * @return A handle for the task. It is not `valid()` if all queues were full or `MaxPending` tasks are
+         *         already in flight.
+         */
+        template<typename F>
+        Handle submit(F &&fn) {
+            const auto record = allocateRecord();
+            if (record >= MaxPending) return Handle();
+
+            const auto start = nextQueue.fetch_add(1, std::memory_order_relaxed);
+            for (std::size_t i = 0; i < Workers; ++i) {
+                auto &queue = workers[(start + i) % Workers].queue;
+                const bool pushed = queue.push([&fn, record](task_t &task) {
+                    task.emplace(std::forward<F>(fn));
+                    task.record = record;
+                });
+                if (pushed) {
+                    pending.put();
+                    return Handle(this, record);
+                }
+            }
+
+            releaseRecord(record);
+            releaseRecord(record);
+            return Handle();
+        }
+
+    private:
+        struct Worker {
+            Worker()
+                : thread(BOUNCE(Worker, run), reinterpret_cast<ULONG>(this)) { ; }
+
+            [[noreturn]] void run() {
+                for (;;) {
+                    owner->pending.get(TX_WAIT_FOREVER);
+
+                    // The semaphore reserves one task, but its submitter may have been preempted between claiming
+                    // and publishing the cell. Spinning would starve a submitter of lower priority, so hand the
+                    // token back and sleep a tick.
+                    task_t task;
+                    if (!owner->takeTask(index, task)) {
+                        owner->pending.put();
+                        tx_thread_sleep(1);
+                        continue;
+                    }
+                    const auto record = task.record;
+                    task.run();
+                    owner->completed.set(bitOf(record));
+                    owner->releaseRecord(record);
+                }
+            }
+
+            ThreadPool *owner{};
+            std::size_t index{};
+            detail::TaskQueue<task_t, QueueDepth> queue;
+            StaticThread<StackSize> thread;
+        };
+
+        static ULONG bitOf(UINT record) {
+            return static_cast<ULONG>(1) << record;
+        }
+
+        /** Own queue first, then steal from the others. */
+        bool takeTask(std::size_t self, task_t &task) {
+            for (std::size_t i = 0; i < Workers; ++i) {
+                if (workers[(self + i) % Workers].queue.pop(task)) return true;
+            }
+            return false;
+        }
+
+        /** Returns a free completion record held by the task and its handle, or MaxPending if there is none. */
+        UINT allocateRecord() {
+            const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+            UINT record = 0;
+            while (record < MaxPending && references[record] != 0) ++record;
+            if (record < MaxPending) references[record] = 2;
+            tx_interrupt_control(posture);
+
+            if (record < MaxPending) completed.clear(bitOf(record));
+            return record;
+        }
+
+        void releaseRecord(UINT record) {
+            const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+            --references[record];
+            tx_interrupt_control(posture);
+        }
+
+        FastSemaphore pending;
+        EventFlags completed;
+        const char *name;
+        std::atomic<std::size_t> nextQueue{};
+        UCHAR references[MaxPending]{};
+        Worker workers[Workers];
+    };
+}
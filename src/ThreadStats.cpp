@@ -0,0 +1,215 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "ThreadStats.hpp"
+#include <cstdint>
+#include "tx_thread.h"
+#ifdef TX_EXECUTION_PROFILE_ENABLE
+#include "tx_execution_profile.h"
+#elif LIBSMART_STM32THREADX_THREAD_STATS_DWT
+#include "main.hpp"
+
+#ifndef TX_ENABLE_EXECUTION_CHANGE_NOTIFY
+#error "LIBSMART_STM32THREADX_THREAD_STATS_DWT needs TX_ENABLE_EXECUTION_CHANGE_NOTIFY in tx_user.h"
+#endif
+#define LIBSMART_STM32THREADX_DWT_BACKEND 1
+#endif
+
+using namespace Stm32ThreadX;
+
+#if LIBSMART_STM32THREADX_DWT_BACKEND
+namespace {
+    /** Cycle counter at the last change of the running context. */
+    std::uint32_t lastChange = 0;
+    /** The thread entered by the scheduler, nullptr while idle. */
+    TX_THREAD *running = nullptr;
+    ULONG isrNesting = 0;
+    ThreadStats::execution_time_t threadTotal = 0;
+    ThreadStats::execution_time_t isrTotal = 0;
+    ThreadStats::execution_time_t idleTotal = 0;
+
+    /**
+     * Charges the cycles since the last change to the context that ran. Interrupts must be disabled. The
+     * difference is taken in 32 bits, so some change or sample must happen within every counter wrap.
+     */
+    void charge() {
+        const std::uint32_t now = DWT->CYCCNT;
+        const std::uint32_t elapsed = now - lastChange;
+        lastChange = now;
+        if (isrNesting != 0) {
+            isrTotal += elapsed;
+        } else if (running != nullptr) {
+            running->libsmart_cycles += elapsed;
+            threadTotal += elapsed;
+        } else {
+            idleTotal += elapsed;
+        }
+    }
+}
+
+// Execution change hooks, called by the Cortex-M ports with TX_ENABLE_EXECUTION_CHANGE_NOTIFY
+extern "C" {
+VOID _tx_execution_initialize(VOID) {
+    ThreadStats::enableCycleCounter();
+}
+
+VOID _tx_execution_thread_enter(VOID) {
+    const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+    charge();
+    running = _tx_thread_current_ptr;
+    tx_interrupt_control(posture);
+}
+
+VOID _tx_execution_thread_exit(VOID) {
+    const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+    charge();
+    running = nullptr;
+    tx_interrupt_control(posture);
+}
+
+VOID _tx_execution_isr_enter(VOID) {
+    const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+    charge();
+    ++isrNesting;
+    tx_interrupt_control(posture);
+}
+
+VOID _tx_execution_isr_exit(VOID) {
+    const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+    charge();
+    if (isrNesting != 0) --isrNesting;
+    tx_interrupt_control(posture);
+}
+}
+
+void ThreadStats::enableCycleCounter() {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    lastChange = DWT->CYCCNT;
+}
+#endif
+
+ThreadStats::ThreadSample ThreadStats::of(const TX_THREAD *thread) {
+    ThreadSample sample;
+    sample.runCount = thread->tx_thread_run_count;
+#ifdef TX_EXECUTION_PROFILE_ENABLE
+    EXECUTION_TIME time{};
+    _tx_execution_thread_time_get(const_cast<TX_THREAD *>(thread), &time);
+    sample.runTime = time;
+#elif LIBSMART_STM32THREADX_DWT_BACKEND
+    const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+    if (thread == running) charge();
+    sample.runTime = thread->libsmart_cycles;
+    tx_interrupt_control(posture);
+#endif
+    return sample;
+}
+
+#if LIBSMART_STM32THREADX_EXECUTION_TIME
+ThreadStats::SystemSample ThreadStats::system() {
+    SystemSample sample;
+#ifdef TX_EXECUTION_PROFILE_ENABLE
+    EXECUTION_TIME time{};
+    _tx_execution_thread_total_time_get(&time);
+    sample.threadTime = time;
+    _tx_execution_isr_time_get(&time);
+    sample.isrTime = time;
+    _tx_execution_idle_time_get(&time);
+    sample.idleTime = time;
+#else
+    const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+    charge();
+    sample.threadTime = threadTotal;
+    sample.isrTime = isrTotal;
+    sample.idleTime = idleTotal;
+    tx_interrupt_control(posture);
+#endif
+    return sample;
+}
+
+ULONG ThreadStats::cycles() {
+#ifdef TX_EXECUTION_PROFILE_ENABLE
+    return static_cast<ULONG>(TX_EXECUTION_TIME_SOURCE);
+#else
+    return DWT->CYCCNT;
+#endif
+}
+
+UINT ThreadStats::cpuLoad(SystemSample &baseline) {
+    const auto now = system();
+    if (now.threadTime < baseline.threadTime || now.isrTime < baseline.isrTime || now.idleTime < baseline.idleTime) {
+        // The times were reset since the baseline was taken
+        baseline = SystemSample();
+    }
+    const auto busy = (now.threadTime - baseline.threadTime) + (now.isrTime - baseline.isrTime);
+    const auto idle = now.idleTime - baseline.idleTime;
+    baseline = now;
+
+    const auto total = busy + idle;
+    return total == 0 ? 0 : static_cast<UINT>(busy * 100 / total);
+}
+#endif
+
+ULONG ThreadStats::report(report_fn fn, void *context) {
+    auto *thread = _tx_thread_created_ptr;
+    const auto count = _tx_thread_created_count;
+    for (ULONG i = 0; i < count && thread != nullptr; ++i) {
+        fn(thread, of(thread), context);
+        thread = thread->tx_thread_created_next;
+    }
+    return count;
+}
+
+ULONG ThreadStats::report(Stm32ItmLogger::LoggerInterface *logger) {
+    const auto count = report([](TX_THREAD *thread, const ThreadSample &sample, void *context) {
+#if LIBSMART_STM32THREADX_EXECUTION_TIME
+        static_cast<Stm32ItmLogger::LoggerInterface *>(context)->printf(
+            "%-24s runs %8lu, time %12llu\r\n",
+            thread->tx_thread_name != nullptr ? thread->tx_thread_name : "?",
+            static_cast<unsigned long>(sample.runCount), static_cast<unsigned long long>(sample.runTime));
+#else
+        static_cast<Stm32ItmLogger::LoggerInterface *>(context)->printf(
+            "%-24s runs %8lu\r\n",
+            thread->tx_thread_name != nullptr ? thread->tx_thread_name : "?",
+            static_cast<unsigned long>(sample.runCount));
+#endif
+    }, logger);
+
+#if LIBSMART_STM32THREADX_EXECUTION_TIME
+    const auto totals = system();
+    logger->printf("threads %llu, isr %llu, idle %llu\r\n",
+                   static_cast<unsigned long long>(totals.threadTime),
+                   static_cast<unsigned long long>(totals.isrTime),
+                   static_cast<unsigned long long>(totals.idleTime));
+#endif
+    return count;
+}
+
+#if LIBSMART_STM32THREADX_EXECUTION_TIME
+void ThreadStats::reset() {
+#ifdef TX_EXECUTION_PROFILE_ENABLE
+    auto *thread = _tx_thread_created_ptr;
+    for (ULONG i = 0; i < _tx_thread_created_count && thread != nullptr; ++i) {
+        _tx_execution_thread_time_reset(thread);
+        thread = thread->tx_thread_created_next;
+    }
+    _tx_execution_thread_total_time_reset();
+    _tx_execution_isr_time_reset();
+    _tx_execution_idle_time_reset();
+#else
+    const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+    auto *thread = _tx_thread_created_ptr;
+    for (ULONG i = 0; i < _tx_thread_created_count && thread != nullptr; ++i) {
+        thread->libsmart_cycles = 0;
+        thread = thread->tx_thread_created_next;
+    }
+    threadTotal = 0;
+    isrTotal = 0;
+    idleTotal = 0;
+    lastChange = DWT->CYCCNT;
+    tx_interrupt_control(posture);
+#endif
+}
+#endif
@@ -0,0 +1,136 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Roland Rusch, easy-smart solution GmbH <roland.rusch@easy-smart.ch>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <libsmart_config.hpp>
+#include "Loggable.hpp"
+#include "tx_api.h"
+
+#if defined(TX_EXECUTION_PROFILE_ENABLE) || LIBSMART_STM32THREADX_THREAD_STATS_DWT
+#define LIBSMART_STM32THREADX_EXECUTION_TIME 1
+#else
+#define LIBSMART_STM32THREADX_EXECUTION_TIME 0
+#endif
+
+namespace Stm32ThreadX {
+    /**
+     * @class ThreadStats
+     * @brief Per-thread and system-wide CPU time accounting.
+     *
+     * Run, ISR and idle times come from one of two backends, both in cycles of the DWT cycle counter:
+     *  - the ThreadX execution profile kit, compiled in with `TX_EXECUTION_PROFILE_ENABLE`, or
+     *  - a built-in backend enabled with `LIBSMART_STM32THREADX_THREAD_STATS_DWT`. It implements the execution
+     *    change hooks that the Cortex-M ports call on every thread switch when `TX_ENABLE_EXECUTION_CHANGE_NOTIFY`
+     *    is defined, and keeps the time of each thread in a field added with `TX_THREAD_USER_EXTENSION`. See
+     *    `libsmart_config.dist.hpp`.
+     *
+     * Without either only the run counts, which ThreadX always keeps, are available. The time members and
+     * functions are not compiled then, so code that relies on them fails to build instead of reading 0.
+     */
+    class ThreadStats {
+    public:
+        using execution_time_t = ULONG64;
+
+        /** CPU time of one thread. */
+        struct ThreadSample {
+            /** Number of times the thread was scheduled. */
+            ULONG runCount{};
+#if LIBSMART_STM32THREADX_EXECUTION_TIME
+            /** Time the thread was running. */
+            execution_time_t runTime{};
+#endif
+        };
+
+#if LIBSMART_STM32THREADX_EXECUTION_TIME
+
+        /** CPU time of the whole system, since start or the last `reset()`. */
+        struct SystemSample {
+            /** Time all threads were running. */
+            execution_time_t threadTime{};
+            /** Time spent in interrupt service routines. */
+            execution_time_t isrTime{};
+            /** Time no thread was ready. */
+            execution_time_t idleTime{};
+        };
+#endif
+
+        using report_fn = void (*)(TX_THREAD *thread, const ThreadSample &sample, void *context);
+
+        /**
+         * @brief Returns the CPU time of a thread.
+         *
+         * @param thread A created thread. For a `Thread`, use `Thread::getCpuTime()`.
+         */
+        static ThreadSample of(const TX_THREAD *thread);
+
+#if LIBSMART_STM32THREADX_EXECUTION_TIME
+        /**
+         * @brief Returns the CPU time of the whole system.
+         */
+        static SystemSample system();
+
+        /**
+         * @brief Returns the current value of the time source, for timing short sections in the same unit.
+         *
+         * The counter wraps at 32 bits, so only differences of intervals shorter than the wrap are meaningful.
+         */
+        static ULONG cycles();
+
+        /**
+         * @brief Returns the CPU load in percent since the caller's previous sample.
+         *
+         * The load is the share of time not spent idle. Every caller keeps its own baseline, so several
+         * supervisors can measure over their own intervals.
+         *
+         * @code
+         * ThreadStats::SystemSample baseline = ThreadStats::system();
+         * for (;;) {
+         *     this_thread::sleepFor(std::chrono::seconds(1));
+         *     const auto load = ThreadStats::cpuLoad(baseline);
+         * }
+         * @endcode
+         *
+         * @param baseline The sample of the previous call, updated to the current one. A default constructed
+         *                 sample measures since start. After `reset()` the interval restarts at the reset.
+         * @return The CPU load, 0 to 100.
+         */
+        static UINT cpuLoad(SystemSample &baseline);
+#endif
+
+        /**
+         * @brief Calls a function with the CPU time of every created thread.
+         *
+         * Threads must not be created or deleted while the report runs.
+         *
+         * @return The number of threads reported.
+         */
+        static ULONG report(report_fn fn, void *context);
+
+        /**
+         * @brief Prints the CPU time of every created thread, one line per thread, and the system totals.
+         *
+         * @return The number of threads reported.
+         */
+        static ULONG report(Stm32ItmLogger::LoggerInterface *logger);
+
+#if LIBSMART_STM32THREADX_EXECUTION_TIME
+        /**
+         * @brief Resets the execution times of all threads and the ISR and idle times.
+         */
+        static void reset();
+#endif
+
+#if LIBSMART_STM32THREADX_THREAD_STATS_DWT && !defined(TX_EXECUTION_PROFILE_ENABLE)
+        /**
+         * @brief Enables the DWT cycle counter.
+         *
+         * Called by the kernel through `_tx_execution_initialize()`. Call it in `tx_application_define()` if the
+         * port does not.
+         */
+        static void enableCycleCounter();
+#endif
+    };
+}
@@ -28,3 +28,33 @@ tick_timer::time_point tick_timer::now() {
     rep ticks = tx_time_get();
     return time_point(duration(ticks));
 }
+
+namespace {
+    /** The 32-bit tick count at the last `tick_timer64::now()`. */
+    ULONG lastTicks = 0;
+    /** The number of wraps of the 32-bit tick count. */
+    ULONG wraps = 0;
+    TX_TIMER wrapTimer;
+}
+
+tick_timer64::time_point tick_timer64::now() {
+    const auto posture = tx_interrupt_control(TX_INT_DISABLE);
+    const ULONG ticks = tx_time_get();
+    if (ticks < lastTicks) ++wraps;
+    lastTicks = ticks;
+    const rep extended = (static_cast<rep>(wraps) << 32) | ticks;
+    tx_interrupt_control(posture);
+    return time_point(duration(extended));
+}
+
+UINT tick_timer64::create() {
+    // Four refreshes per wrap period, so a wrap is never missed
+    constexpr ULONG interval = 0x40000000UL;
+    // https://github.com/eclipse-threadx/rtos-docs/blob/main/rtos-docs/threadx/chapter4.md#tx_timer_create
+    return tx_timer_create(&wrapTimer, const_cast<CHAR *>("Stm32ThreadX::tick_timer64"), &tick_timer64::refresh, 0,
+                           interval, interval, TX_AUTO_ACTIVATE);
+}
+
+void tick_timer64::refresh(ULONG) {
+    now();
+}
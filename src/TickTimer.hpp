@@ -23,6 +23,7 @@
 #define LIBSMART_STM32THREADXTHREAD_STM32THREADXTICKTIMER_HPP
 
 #include <chrono>
+#include <cstdint>
 #include "tx_api.h"
 //#include "Stm32ThreadxThread.hpp"
 
@@ -54,6 +55,39 @@ namespace Stm32ThreadX {
         static time_point now();
     };
 
+    /**
+     * @brief A 64-bit extension of the ThreadX tick counter, which does not wrap in practice.
+     *
+     * `tick_timer` wraps after 2^32 ticks, about 49 days at 1 kHz. `tick_timer64` counts the wraps of the
+     * 32-bit counter itself. Every `now()` compares the counter with the last value seen under a short interrupt
+     * lock, so it is safe for concurrent readers in threads and ISRs. A wrap is only detected if `now()` runs at
+     * least once per 2^32 ticks; `create()` starts an application timer that guarantees this.
+     */
+    class tick_timer64 {
+    public:
+        using rep = std::uint64_t;
+        using period = tick_timer::period;
+        using duration = std::chrono::duration<rep, period>;
+        using time_point = std::chrono::time_point<tick_timer64>;
+        static constexpr bool is_steady = true;
+
+        /**
+         * @brief Returns the extended tick count.
+         * @remark Thread and ISR context callable
+         */
+        static time_point now();
+
+        /**
+         * @brief Starts the timer that keeps the wrap detection alive when `now()` is rarely called.
+         *
+         * @return The status code of `tx_timer_create()`.
+         */
+        static UINT create();
+
+    private:
+        static void refresh(ULONG);
+    };
+
     /**
      * @brief Converts duration to the underlying tick count.
      *
@@ -96,6 +130,13 @@ namespace Stm32ThreadX {
         return toTicks(time.time_since_epoch());
     }
 
+    /**
+     * @brief Converts an extended time point to the underlying 64-bit tick count.
+     */
+    constexpr tick_timer64::rep toTicks(const tick_timer64::time_point &time) {
+        return time.time_since_epoch().count();
+    }
+
     /**
      * @brief  Dedicated @ref tick_timer::duration expression that ensures infinite wait time on an operation.
      */
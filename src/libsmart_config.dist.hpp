@@ -8,5 +8,51 @@
 
 #define LIBSMART_STM32THREADX
 
+/**
+ * Least severe log level compiled into the Stm32ThreadX wrapper classes.
+ * Must be the name of a Stm32ItmLogger::LoggerInterface::Severity enumerator. Log calls of a lower severity are
+ * removed at compile time, e.g. set to INFORMATIONAL to drop the DEBUGGING output of every send/get/put/set call.
+ */
+#ifndef LIBSMART_STM32THREADX_LOG_SEVERITY_MIN
+#define LIBSMART_STM32THREADX_LOG_SEVERITY_MIN DEBUGGING
+#endif
+
+/**
+ * Maximum number of queues, semaphores and event flags groups registered with any Stm32ThreadX::QueueSet at the
+ * same time, summed over all sets.
+ */
+#ifndef LIBSMART_STM32THREADX_QUEUESET_MAX_MEMBERS
+#define LIBSMART_STM32THREADX_QUEUESET_MAX_MEMBERS 16
+#endif
+
+/**
+ * Set to 1 to let every Stm32ThreadX::Mutex record hold and wait time statistics. Costs two tx_time_get() calls
+ * and a short interrupt lock per lock/unlock pair.
+ */
+#ifndef LIBSMART_STM32THREADX_MUTEX_STATS
+#define LIBSMART_STM32THREADX_MUTEX_STATS 0
+#endif
+
+/**
+ * Set to 1 to let Stm32ThreadX::ThreadStats time threads, interrupts and idle with the DWT cycle counter when the
+ * ThreadX execution profile kit (TX_EXECUTION_PROFILE_ENABLE) is not used. tx_user.h must then contain:
+ *
+ *     #define TX_ENABLE_EXECUTION_CHANGE_NOTIFY
+ *     #define TX_THREAD_USER_EXTENSION ULONG64 libsmart_cycles;
+ *
+ * Interrupt time is only counted for ISRs that call _tx_execution_isr_enter() and _tx_execution_isr_exit(), and
+ * idle time is not counted while the core sleeps with the cycle counter stopped.
+ */
+#ifndef LIBSMART_STM32THREADX_THREAD_STATS_DWT
+#define LIBSMART_STM32THREADX_THREAD_STATS_DWT 0
+#endif
+
+/**
+ * Set to 1 to add the notification word to Stm32ThreadX::Thread. When enabled, every thread, including pool and
+ * shard workers, embeds and creates a TX_SEMAPHORE that is used to wake it in this_thread::notify_wait_for().
+ */
+#ifndef LIBSMART_STM32THREADX_THREAD_NOTIFICATIONS
+#define LIBSMART_STM32THREADX_THREAD_NOTIFICATIONS 0
+#endif
 
 #endif